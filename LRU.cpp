@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+#include "libstdc++/object_pool.hpp"
 using namespace std;
 #define ll  long long
 #define pll pair<ll,ll>
@@ -18,20 +19,29 @@ struct Node {
     Node *prev; 
     Node(int key, int value): key(key), value(value), next(nullptr), prev(nullptr) {}
 }; 
+// Nodes come from an ObjectPool instead of new/delete: every put() that
+// evicts hands its node straight back to the pool, so a full cache churns
+// through the same slots with no malloc/free at all.
 class LRUCache {
     
 public:
+    career::ObjectPool<Node> pool; 
     Node *head; 
     Node *tail; 
     unordered_map<int, Node *> nodeMap; 
     int capacity;
     LRUCache(int capacity): capacity(capacity) {
-        head = new Node(-1, -1); 
-        tail = new Node(-1, -1); 
+        head = pool.acquire(-1, -1); 
+        tail = pool.acquire(-1, -1); 
         head->next = tail; 
         tail->prev = head;
         nodeMap.clear(); 
     }
+    ~LRUCache() {
+        for (auto &it : nodeMap) pool.release(it.second);
+        pool.release(head);
+        pool.release(tail);
+    }
     void put(int key, int value) {
         if (!nodeMap.count(key)) {
             if (nodeMap.size() == capacity) {
@@ -39,9 +49,10 @@ public:
                 delete_operation(node_need_erase->key);
                 // cout << node_need_erase->key <<" check" <<" "<<capacity <<" "<<nodeMap.size()<<endl;
                 nodeMap.erase(node_need_erase->key);
+                pool.release(node_need_erase);
                 // cout << nodeMap.size()<<" check"<<endl;
             }
-            nodeMap[key] = new Node(key, value);
+            nodeMap[key] = pool.acquire(key, value);
             insert_operation(key);
         } else {
             nodeMap[key]->value = value;
@@ -1,65 +1,97 @@
 #include<bits/stdc++.h>
+#include "libstdc++/allocator_traits.hpp"
+#include "libstdc++/uninitialized.hpp"
 using namespace std; 
 
 class String {
 private: 
+    // Storage goes through allocator_traits so growth can use the
+    // allocator's reallocate hook: swap in career::remap_allocator<char>
+    // and a big String grows by mremap instead of copying.
+    using Alloc = career::allocator<char>;
+    using Traits = career::allocator_traits<Alloc>;
+
     char *str;
     int size = 0;
+    int capacity = 0;   // chars, not counting the '\0'
+
+    static char* allocate(int cap) {
+        Alloc a;
+        return Traits::allocate(a, cap + 1);
+    }
+
+    static void deallocate(char* p, int cap) noexcept {
+        Alloc a;
+        Traits::deallocate(a, p, cap + 1);
+    }
+
+    // char is trivially copyable: one reallocate call moves the bytes
+    // (the '\0' included), no per-char copy loop
+    void grow_to(int min_cap) {
+        int new_cap = capacity ? capacity * 2 : 15;
+        if (new_cap < min_cap) {
+            new_cap = min_cap;
+        }
+        Alloc a;
+        str = Traits::reallocate(a, str, capacity + 1, new_cap + 1);
+        capacity = new_cap;
+    }
+
 public: 
     // 0 argument constructor 
     String() {
-        str = new char[1];
+        str = allocate(0);
         size = 0;
         str[0] = '\0';
     }
     // 1 argument constructor 
     String(const char *param) {
-       size = strlen(param);
-       str = new char[size + 1];
+       size = capacity = strlen(param);
+       str = allocate(capacity);
        memcpy(str, param, size); 
        str[size] = '\0';
     }
     // copy constructor 
     String(const String& o) {
-        size = strlen(o.str);
-        str = new char[size + 1]; 
+        size = capacity = o.size;
+        str = allocate(capacity); 
         memcpy(str, o.str, size);
         str[size] = '\0';
     }
     // copy assignment 
     String& operator=(const String& o) {
-        String copy(o.str);
-        size = o.size; 
-        swap(this->str, copy.str);
+        String copy(o);
+        swap(*this, copy);
         return *this;
     }
-    // move constructor 
-    String(String&& o) {
-        size = strlen(o.str); 
-        swap(this->str, o.str);
+    // move constructor - leaves o as a valid empty string
+    String(String&& o) : String() {
+        swap(*this, o);
     }
     // move assignment 
     String& operator=(String&& o) {
-        size = strlen(o.str); 
-        swap(this->str, o.str);
+        swap(*this, o);
         return *this;
     }
     // destructor 
     ~String() {
-        delete[] str;
+        deallocate(str, capacity);
+    }
+
+    friend void swap(String& a, String& b) noexcept {
+        std::swap(a.str, b.str);
+        std::swap(a.size, b.size);
+        std::swap(a.capacity, b.capacity);
     }
 
-    // push_back 
+    // push_back - amortized O(1): capacity doubles, and growing is one
+    // allocator_traits::reallocate instead of new + copy + delete per char
     void push_back(char c) {
-        size++;
-        char* newBuffer = new char[size + 1]; 
-        for (int i = 0; i < size - 1; i++) {
-            newBuffer[i] = str[i];
+        if (size == capacity) {
+            grow_to(size + 1);
         }
-        newBuffer[size - 1] = c; 
-        newBuffer[size] = '\0'; 
-        delete[] str; 
-        str = newBuffer;
+        str[size++] = c;
+        str[size] = '\0';
     }
 
     // access string element 
@@ -72,24 +104,19 @@ public:
 
     // + opeartor 
     String operator+(const String& o) {
-        int newSize = size + o.size; 
-        char *newBuffer = new char[newSize + 1]; 
-        memcpy(newBuffer, str, size); 
-        memcpy(newBuffer + size, o.str, o.size);
-        newBuffer[newSize] = '\0';
-        String result(newBuffer);
+        String result(*this);
+        result += o;
         return result;
     }
 
     // += operator 
     String& operator+=(const String& o) {
         int newSize = size + o.size; 
-        char *newBuffer = new char[newSize + 1]; 
-        memcpy(newBuffer, str, size); 
-        memcpy(newBuffer + size, o.str, o.size);
-        newBuffer[newSize] = '\0';
-        delete[] str; 
-        str = newBuffer;
+        if (newSize > capacity) {
+            grow_to(newSize);
+        }
+        memmove(str + size, o.str, o.size);
+        str[newSize] = '\0';
         size = newSize;
         return *this;
     }
@@ -105,6 +132,10 @@ public:
     }
 }; 
 
+// String is just {char*, int, int} - no pointer into itself - so a buffer of
+// Strings can grow by memmove instead of move + destroy per element
+template<> struct career::is_trivially_relocatable<String> : std::true_type {};
+
 int main() {
     String s("Hello world! ");
     String t("I'm a noob and try to print"); 
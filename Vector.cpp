@@ -1,109 +1,322 @@
 #include <bits/stdc++.h>
-using namespace std; 
+#include "libstdc++/allocator_traits.hpp"
+#include "libstdc++/storage_policy.hpp"
+#include "libstdc++/uninitialized.hpp"
+using namespace std;
 
-/// some note: we can replace new by allocator, then call allocate, construct for new and 
+/// some note: memory and objects are separate things. The allocator hands out raw
+/// capacity, allocator_traits::construct / destroy start and end the lifetime of one
+/// element in it. new T[cap] does both at once and default-constructs every spare slot.
 /// Very important: Value categories are given to expressions and not types!
-template<typename T> 
-class Vector { 
-private: 
-  T* m_value; 
-  int m_size; 
-  int m_cap; 
+//
+//   m_value                          m_value + m_size          m_value + m_cap
+//   |  constructed T | constructed T |  raw  |  raw  |  raw  |
+//                                    ^ push_back constructs here
+//
+// Only [0, m_size) holds objects. reserve() moves them to a new raw block, pop_back()
+// destroys the last one, and nothing past m_size is ever constructed.
+//
+// Growth: reserve(n) gives exactly n. A full push_back grows by GrowthFactor, a
+// std::ratio. 2x (the default) reallocates least often. 3/2 wastes less memory, and
+// being under the golden ratio, the blocks freed so far eventually add up to the next
+// request, so the allocator can hand that memory back instead of asking for more.
+template<typename T, typename Allocator = career::allocator<T>, typename GrowthFactor = std::ratio<2>>
+class Vector {
+private:
+  using alloc_traits = career::allocator_traits<Allocator>;
 
-public:
-  // constructor 
-  Vector() {
-    m_value = new T[1]; 
+  Allocator m_alloc;
+  T* m_value = nullptr;
+  int m_size = 0;
+  int m_cap = 0;
+
+  // raw block of n elements, nothing constructed
+  T* allocate(int n) {
+    return n ? alloc_traits::allocate(m_alloc, size_t(n)) : nullptr;
+  }
+  void deallocate(T* p, int n) noexcept {
+    if (p) alloc_traits::deallocate(m_alloc, p, size_t(n));
+  }
+  void destroy_all() noexcept {
+    for (int i = 0; i < m_size; i++) {
+      alloc_traits::destroy(m_alloc, m_value + i);
+    }
+  }
+  // destroy everything and free the block, leaving an empty vector
+  void release() noexcept {
+    destroy_all();
+    deallocate(m_value, m_cap);
+    m_value = nullptr;
     m_size = 0;
-    m_cap = 1;
+    m_cap = 0;
+  }
+  // exchange blocks only - the allocators stay where they are
+  void swap_storage(Vector& o) noexcept {
+    std::swap(this->m_value, o.m_value);
+    std::swap(this->m_size, o.m_size);
+    std::swap(this->m_cap, o.m_cap);
+  }
+  static constexpr bool ALLOC_STEALS =
+      alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value;
+  static constexpr bool ALLOC_SWAPS =
+      alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value;
+  static_assert(GrowthFactor::num > GrowthFactor::den, "growth factor must be > 1");
+
+  // capacity for at least `needed` elements, growing geometrically from m_cap
+  int next_capacity(long long needed) const {
+    if (needed > max_size()) {
+      throw length_error("Vector exceeds max_size()");
+    }
+    long long grown = (long long)m_cap * GrowthFactor::num / GrowthFactor::den;
+    grown = std::max<long long>({grown, needed, INITIAL_CAPACITY});
+    return int(std::min<long long>(grown, max_size()));
+  }
+  // Move [0, m_size) into the raw block dst, cheapest safe way first:
+  //   trivially relocatable  : one memcpy, the old objects are simply forgotten
+  //   noexcept move          : move + destroy each element in one pass
+  //   copyable               : copy, so a throwing copy leaves *this untouched
+  //   move-only, may throw   : move anyway (no strong guarantee, as std::vector)
+  // Afterwards the old block holds no objects.
+  void relocate_into(T* dst) {
+    if constexpr (career::is_trivially_relocatable_v<T> || career::is_nothrow_move_constructible_v<T>) {
+      career::uninitialized_relocate(m_value, m_value + m_size, dst);
+    } else if constexpr (career::is_constructible_v<T, const T&>) {
+      career::uninitialized_copy(m_value, m_value + m_size, dst);
+      destroy_all();
+    } else {
+      career::uninitialized_move(m_value, m_value + m_size, dst);
+      destroy_all();
+    }
+  }
+  // move the elements to a block of exactly new_cap (>= m_size) elements
+  void reallocate(int new_cap) {
+    if (new_cap == 0) {
+      deallocate(m_value, m_cap);
+      m_value = nullptr;
+      m_cap = 0;
+      return;
+    }
+    // plain bytes: the allocator grows the block in place, remaps it, or memcpys it
+    if constexpr (career::is_trivially_copyable_v<T>) {
+      m_value = alloc_traits::reallocate(m_alloc, m_value, size_t(m_cap), size_t(new_cap));
+      m_cap = new_cap;
+      return;
+    }
+    // the allocator may be able to grow the block where it is (remap_allocator)
+    if (m_value && new_cap > m_cap &&
+        alloc_traits::try_expand(m_alloc, m_value, size_t(m_cap), size_t(new_cap))) {
+      m_cap = new_cap;
+      return;
+    }
+    T* temp = allocate(new_cap);
+    try {
+      relocate_into(temp);
+    } catch (...) {
+      deallocate(temp, new_cap);
+      throw;
+    }
+    deallocate(m_value, m_cap);
+    m_value = temp;
+    m_cap = new_cap;
+  }
+  // emplace_back on a full vector. args may refer into the old block
+  // (v.emplace_back(v[0])), so the new element is constructed in the new block
+  // BEFORE the old elements are relocated out of it and it is freed.
+  template<typename... Args>
+  T& grow_and_emplace(Args&&... args) {
+    int new_cap = next_capacity((long long)m_size + 1);
+    // plain bytes: build the value first, then the allocator can grow, remap
+    // or memcpy the block however it likes
+    if constexpr (career::is_trivially_copyable_v<T>) {
+      T value(std::forward<Args>(args)...);
+      reallocate(new_cap);
+      alloc_traits::construct(m_alloc, m_value + m_size, std::move(value));
+      m_size++;
+      return m_value[m_size - 1];
+    }
+    // grown in place: nothing moved, args are still valid
+    if (m_value && alloc_traits::try_expand(m_alloc, m_value, size_t(m_cap), size_t(new_cap))) {
+      m_cap = new_cap;
+      alloc_traits::construct(m_alloc, m_value + m_size, std::forward<Args>(args)...);
+      m_size++;
+      return m_value[m_size - 1];
+    }
+    T* temp = allocate(new_cap);
+    try {
+      alloc_traits::construct(m_alloc, temp + m_size, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(temp, new_cap);
+      throw;
+    }
+    try {
+      relocate_into(temp);
+    } catch (...) {
+      alloc_traits::destroy(m_alloc, temp + m_size);
+      deallocate(temp, new_cap);
+      throw;
+    }
+    deallocate(m_value, m_cap);
+    m_value = temp;
+    m_cap = new_cap;
+    m_size++;
+    return m_value[m_size - 1];
   }
-  // constructor with size 
-  Vector(int size) {
-    cout <<"size constructor" <<" check" << endl; 
-    m_value = new T[size]; 
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+
+  // first buffer fills one cache line (at least 1 element), picked per T at
+  // compile time - no 1 -> 2 -> 4 -> 8 reallocations for small types
+  static constexpr int INITIAL_CAPACITY = int(career::block_layout<T, career::CACHE_LINE_SIZE>::count);
+  static constexpr double GROWTH_FACTOR = double(GrowthFactor::num) / GrowthFactor::den;
+  // constructor: allocates nothing, the first push_back takes INITIAL_CAPACITY
+  Vector() noexcept(noexcept(Allocator())) : Vector(Allocator()) {}
+  explicit Vector(const Allocator& alloc) noexcept : m_alloc(alloc) {}
+  // constructor with size: value-initialized elements
+  Vector(int size, const Allocator& alloc = Allocator()) : m_alloc(alloc) {
+    cout <<"size constructor" <<" check" << endl;
+    m_value = allocate(size);
+    try {
+      career::uninitialized_value_construct_n(m_value, size);
+    } catch (...) {
+      deallocate(m_value, size);
+      throw;
+    }
     m_size = size;
     m_cap = size;
   }
   // constructor with std::initializer_list
   // Vector(std::initializer_list<T> init_list) {
-  //   cout <<"initialize list" << " check" << endl; 
-  //   m_size = init_list.size(); 
+  //   cout <<"initialize list" << " check" << endl;
+  //   m_size = init_list.size();
   //   m_cap = init_list.size();
-  //   m_value = new T[m_size]; 
+  //   m_value = new T[m_size];
   //   for (int i = 0; i < m_size; i++) {
   //     m_value[i] = init_list.begin()[i];
   //   }
   // }
-  // copy constructor 
-  Vector(const Vector<T>& o) {
+  // copy constructor: copy-construct into raw memory, no default-construct + assign
+  Vector(const Vector& o) : Vector(o, alloc_traits::select_on_container_copy_construction(o.m_alloc)) {
     cout <<"copy constructor" <<" check" << endl;
-    this->m_size = o.m_size; 
-    this->m_cap = o.m_cap;
-    this->m_value = new T[this->m_cap];
-    for (int i = 0; i < this->m_size; i++) {
-      this->m_value[i] = o.m_value[i];
+  }
+  Vector(const Vector& o, const Allocator& alloc) : m_alloc(alloc) {
+    m_value = allocate(o.m_cap);
+    try {
+      career::uninitialized_copy(o.m_value, o.m_value + o.m_size, m_value);
+    } catch (...) {
+      deallocate(m_value, o.m_cap);
+      throw;
     }
+    m_size = o.m_size;
+    m_cap = o.m_cap;
   }
-  // copy assignment 
-  Vector<T>& operator=(const Vector<T>& o) {
+  // copy assignment. With propagate_on_container_copy_assignment we take o's
+  // allocator too - after giving our block back to the allocator that made it.
+  Vector& operator=(const Vector& o) {
     cout <<"copy assignment" << " check" << endl;
-    Vector<T> temp = Vector(o);
-    this->swap(temp);
+    if (this == &o) return *this;
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+      if (!alloc_traits::is_always_equal::value && m_alloc != o.m_alloc) {
+        release();
+      }
+      m_alloc = o.m_alloc;
+    }
+    Vector temp(o, m_alloc);
+    swap_storage(temp);
     return *this;
   }
-  // move constructor 
-  Vector(Vector<T>&& o) {
+  // move constructor: steal the block, o is left empty
+  Vector(Vector&& o) noexcept : m_alloc(std::move(o.m_alloc)) {
     cout <<"move constructor" << " check" << endl;
-    std::swap(this->m_size, o.m_size); 
-    std::swap(this->m_cap, o.m_cap); 
-    std::swap(this->m_value, o.m_value);
+    swap_storage(o);
   }
-  // move assignment 
-  Vector<T>& operator=(Vector<T>&& o) {
+  // move into memory from `alloc`: steal if it can free o's block, else move
+  // the elements one by one
+  Vector(Vector&& o, const Allocator& alloc) : m_alloc(alloc) {
+    if (alloc_traits::is_always_equal::value || m_alloc == o.m_alloc) {
+      swap_storage(o);
+      return;
+    }
+    m_value = allocate(o.m_size);
+    try {
+      career::uninitialized_move(o.m_value, o.m_value + o.m_size, m_value);
+    } catch (...) {
+      deallocate(m_value, o.m_size);
+      throw;
+    }
+    m_size = o.m_size;
+    m_cap = o.m_size;
+  }
+  // move assignment: steal o's block when our allocator can free it (it
+  // propagates, or the two compare equal), otherwise move element-wise
+  Vector& operator=(Vector&& o) noexcept(ALLOC_STEALS) {
     cout <<"move assignment" << " check" << endl;
-    auto moved = Vector<T>(std::move(o));
-    this->swap(moved); 
+    if (this == &o) return *this;
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      release();
+      m_alloc = std::move(o.m_alloc);
+      swap_storage(o);
+    } else {
+      Vector temp(std::move(o), m_alloc);
+      swap_storage(temp);
+    }
     return *this;
   }
-  // destructor 
-  ~Vector<T>() {
-    delete[] m_value;
+  // destructor: end the lifetime of [0, m_size), then free the whole block
+  ~Vector() {
+    release();
   }
-  void swap(Vector& temp) {
-    std::swap(this->m_value, temp.m_value);
-    std::swap(this->m_size, temp.m_size); 
-    std::swap(this->m_cap, temp.m_cap);
+  // Blocks only swap if each allocator can free the other's: it propagates
+  // on swap, or they compare equal. Otherwise each side's elements are moved
+  // into memory from the other side's allocator.
+  void swap(Vector& o) noexcept(ALLOC_SWAPS) {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(this->m_alloc, o.m_alloc);
+      swap_storage(o);
+    } else {
+      if (alloc_traits::is_always_equal::value || m_alloc == o.m_alloc) {
+        swap_storage(o);
+        return;
+      }
+      Vector mine(std::move(*this), o.m_alloc);
+      Vector theirs(std::move(o), m_alloc);
+      swap_storage(theirs);
+      o.swap_storage(mine);
+    }
   }
+  // exactly new_cap, never less than size(); existing elements are relocated
   void reserve(int new_cap) {
     if (new_cap <= m_cap) return;
-    m_cap = m_cap * 2; 
-    T* temp = new T[m_cap];
-    for (int i = 0; i < this->m_size; i++) {
-      temp[i] = this->m_value[i];
+    if (new_cap > max_size()) {
+      throw length_error("Vector::reserve exceeds max_size()");
     }
-    delete[] m_value;
-    m_value = temp;
+    reallocate(new_cap);
   }
-  template<typename... Args> 
-  void emplace_back(Args... args) {
-    if (m_size == m_cap) {
-      reserve(2 * m_cap);
+  // give back the unused capacity (may still be a no-op if the block can't shrink)
+  void shrink_to_fit() {
+    if (m_cap > m_size) {
+      reallocate(m_size);
     }
-    m_value[m_size] = T(std::forward<Args>(args)...); 
-    m_size++;
   }
-  void push_back(T n_elem) {
+  template<typename... Args>
+  T& emplace_back(Args&&... args) {
     if (m_size == m_cap) {
-      reserve(2 * m_cap);
+      return grow_and_emplace(std::forward<Args>(args)...);
     }
-    m_value[m_size] = std::move(n_elem); 
+    alloc_traits::construct(m_alloc, m_value + m_size, std::forward<Args>(args)...);
     m_size++;
+    return m_value[m_size - 1];
+  }
+  void push_back(T n_elem) {
+    emplace_back(std::move(n_elem));
   }
   void pop_back() {
     if (m_size == 0) {
       throw out_of_range("Cannot popback the empty vector");
     }
     m_size--;
+    alloc_traits::destroy(m_alloc, m_value + m_size);
   }
   T& operator[](int index) {
     if (index < 0 || index >= m_size) {
@@ -123,23 +336,33 @@ public:
   int capacity() const noexcept {
     return this->m_cap;
   }
-  friend ostream& operator<<(ostream& os, Vector<T>& vt) {
-    os << "["; 
+  bool empty() const noexcept {
+    return this->m_size == 0;
+  }
+  int max_size() const noexcept {
+    return int(std::min<size_t>(alloc_traits::max_size(m_alloc), size_t(INT_MAX)));
+  }
+  void clear() noexcept {
+    destroy_all();
+    m_size = 0;
+  }
+  allocator_type get_allocator() const noexcept {
+    return m_alloc;
+  }
+  friend ostream& operator<<(ostream& os, const Vector& vt) {
+    os << "[";
     for (int i = 0; i < vt.size(); i++) {
       if (i > 0) os << ", ";
-      os << vt[i]; 
+      os << vt[i];
     }
     os << "]";
     return os;
   }
-  friend void swap(vector<T>& a, vector<T>& b) {
-    // std::swap(a.m_value, b.m_value); 
-    // std::swap(a.m_size, b.m_size); 
-    // std::swap(a.m_cap, b.m_cap);
+  friend void swap(Vector& a, Vector& b) noexcept(ALLOC_SWAPS) {
     a.swap(b);
   }
   using iterator = T*;
-  using const_iterator = const T*; 
+  using const_iterator = const T*;
 
   iterator begin() {
     return m_value;
@@ -150,26 +373,40 @@ public:
   const_iterator begin() const{
     return m_value;
   }
-  const_iterator end() const{ 
+  const_iterator end() const{
     return m_value + m_size;
   }
 
-}; 
+};
+
+#ifndef VECTOR_NO_MAIN
+// no default constructor: new T[cap] couldn't even compile for it
+struct NoDefault {
+  explicit NoDefault(int x) : x(x) {}
+  int x;
+};
 
 int main() {
-  // vector<int> vt1; 
-  // cout << vt1.size() <<" " << vt1.capacity() << endl; 
-  // Vector<int> vt; 
+  // vector<int> vt1;
+  // cout << vt1.size() <<" " << vt1.capacity() << endl;
+  // Vector<int> vt;
   // cout << vt.size() <<" " << vt.capacity() << endl;
-  // vt.push_back(0); 
-  // vt.push_back(10); 
+  // vt.push_back(0);
+  // vt.push_back(10);
   // vt.push_back(-100);
-  // int size = vt.size(); 
+  // int size = vt.size();
   // cout << vt << endl;
-  // Vector<int> vt1(vt); 
+  // Vector<int> vt1(vt);
   // cout << vt1 << endl;
   // Vector<int> a{1, 2, 3, 4};
   Vector<int> b(3);
   Vector<int> vt(std::move(b));
 
-} 
\ No newline at end of file
+  Vector<NoDefault> nd;
+  for (int i = 0; i < 20; i++) {
+    nd.emplace_back(i);
+  }
+  nd.pop_back();
+  cout << nd.size() << " " << nd[18].x << endl;
+}
+#endif
@@ -1,3 +1,15 @@
+#pragma once
+
+#include <algorithm> 
+#include <cstddef> 
+#include <cstring> 
+#include <limits> 
+#include <new> 
+#include <type_traits> 
+#include <utility> 
+
+#include "pointer_traits.hpp"
+
 namespace career {
 
 template<typename T> 
@@ -8,17 +20,21 @@ public:
     // ===========================================================
     using value_type = T; 
     using size_type = size_t; 
-    using difference_type = ptfdiff_t; 
+    using difference_type = ptrdiff_t; 
     using pointer = T*; 
     using const_pointer = const T*;
-    using refernce = T&; 
+    using reference = T&; 
     using const_reference = const T&;
 
+    // Stateless: any two allocators are interchangeable
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
     // rebind: convert allocator<T> to allocator<U>
     template<typename U> 
     struct rebind {
         using other = allocator<U>;
-    }
+    };
 
     // ==========================================================
     // Constructos & Destructor 
@@ -39,22 +55,39 @@ public:
     // CORE FUNCTIONS (The 4 essential operations)
     // =========================================================
 
+    // Plain ::operator new only guarantees __STDCPP_DEFAULT_NEW_ALIGNMENT__
+    // (16 on x86-64). Anything stricter - alignas(64) counters, AVX-512
+    // vectors - must go through the std::align_val_t overloads.
+    static constexpr bool is_over_aligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
     // 1. ALLOCATE - Get raw memory (no construction!)
-    [[nodiscard]] T* allocator(size_type n) {
+    [[nodiscard]] T* allocate(size_type n) {
         if (n > max_size()) {
-            throw std::bad_alloc();
+            throw std::bad_array_new_length();
         }
 
         // Request n * sizeof(T) bytes from system 
-        void* p = ::operator new(n * sizeof(T)); 
+        void* p; 
+        if constexpr (is_over_aligned) {
+            p = ::operator new(n * sizeof(T), std::align_val_t(alignof(T)));
+        } else {
+            p = ::operator new(n * sizeof(T));
+        }
 
         // Cast to T* and return 
         return static_cast<T*>(p); 
     }
 
     // 2. DEALLOCATE - Return memory to system (no destruction!)
+    // We always know n, so pass the size along: sized delete lets malloc
+    // implementations (tcmalloc, jemalloc, mimalloc) skip the size-class
+    // lookup for the pointer, which is their slowest step in free().
     void deallocate(T* p, size_type n) noexcept {
-        ::operator delete(p);
+        if constexpr (is_over_aligned) {
+            ::operator delete(p, n * sizeof(T), std::align_val_t(alignof(T)));
+        } else {
+            ::operator delete(p, n * sizeof(T));
+        }
     }
 
     // 3. CONSTRUCT - Build object in already-allocated memory 
@@ -73,7 +106,7 @@ public:
     // Helper functions 
     // ===============================================================
     [[nodiscard]] size_type max_size() const noexcept {
-        return std::numeric_litmits<size_type>::max() / sizeof(T); 
+        return std::numeric_limits<size_type>::max() / sizeof(T); 
     }
 
     // Get address
@@ -102,21 +135,117 @@ bool operator!=(const allocator<T>&, const allocator<U>&) noexcept {
 // ===========================================================
 // allocator_traits - The Smart Wrapper
 // ===========================================================
+//
+// An allocator only HAS to provide value_type, allocate and deallocate.
+// Everything else is looked up with SFINAE and falls back to a default:
+//
+//   member                        if Alloc doesn't say
+//   ----------------------------  --------------------------------------
+//   pointer                       value_type*
+//   const_pointer / void_pointer  pointer rebound to const T / void
+//   difference_type               pointer_traits<pointer>::difference_type
+//   size_type                     make_unsigned_t<difference_type>
+//   propagate_on_container_*      false_type
+//   is_always_equal               is_empty<Alloc> (stateless => equal)
+//   rebind_alloc<U>               Alloc::rebind<U>::other, else
+//                                 Template<T, Rest...> -> Template<U, Rest...>
+//
+// The propagate / is_always_equal traits are what let a container pick its
+// fast paths at compile time, e.g. move assignment:
+//
+//   POCMA || is_always_equal  -> steal the buffer, O(1), noexcept
+//   otherwise                 -> compare allocators at runtime, and move
+//                                element by element if they differ
+//
+// Stateful allocators (arena_allocator) set POCMA/POCCA/POCS so the
+// allocator travels with the memory; stateless ones (allocator,
+// pool_allocator) are is_always_equal.
+
+namespace detail {
+
+// detected_or_t<Default, Op, Args...> = Op<Args...> if well-formed, else Default
+template<typename Default, typename AlwaysVoid, template<typename...> class Op, typename... Args>
+struct detector {
+    using type = Default;
+};
+
+template<typename Default, template<typename...> class Op, typename... Args>
+struct detector<Default, std::void_t<Op<Args...>>, Op, Args...> {
+    using type = Op<Args...>;
+};
+
+template<typename Default, template<typename...> class Op, typename... Args>
+using detected_or_t = typename detector<Default, void, Op, Args...>::type;
+
+// The member typedefs we look for
+template<typename A> using pointer_of = typename A::pointer;
+template<typename A> using const_pointer_of = typename A::const_pointer;
+template<typename A> using void_pointer_of = typename A::void_pointer;
+template<typename A> using const_void_pointer_of = typename A::const_void_pointer;
+template<typename A> using difference_type_of = typename A::difference_type;
+template<typename A> using size_type_of = typename A::size_type;
+template<typename A> using pocca_of = typename A::propagate_on_container_copy_assignment;
+template<typename A> using pocma_of = typename A::propagate_on_container_move_assignment;
+template<typename A> using pocs_of = typename A::propagate_on_container_swap;
+template<typename A> using is_always_equal_of = typename A::is_always_equal;
+
+// rebind fallback: Template<T, Rest...> -> Template<U, Rest...>
+template<typename Alloc, typename U>
+struct rebind_first_arg {};
+
+template<template<typename, typename...> class Template, typename T, typename... Rest, typename U>
+struct rebind_first_arg<Template<T, Rest...>, U> {
+    using type = Template<U, Rest...>;
+};
+
+// rebind: Alloc::rebind<U>::other wins when the allocator provides it
+template<typename Alloc, typename U, typename = void>
+struct rebind_alloc_impl : rebind_first_arg<Alloc, U> {};
+
+template<typename Alloc, typename U>
+struct rebind_alloc_impl<Alloc, U, std::void_t<typename Alloc::template rebind<U>::other>> {
+    using type = typename Alloc::template rebind<U>::other;
+};
+
+} // namespace detail
 
 template<typename Alloc> 
 struct allocator_traits {
     using allocator_type = Alloc; 
     using value_type = typename Alloc::value_type;
-    using size_type = typename Alloc::size_type;
-    using difference_type = typename Alloc::difference_type;
-    using pointer = typename Alloc::pointer;
-    using const_pointer = typename Alloc::const_pointer;
+
+    // ===========================================================
+    // Pointer & size types (detected, with fallbacks)
+    // ===========================================================
+    using pointer = detail::detected_or_t<value_type*, detail::pointer_of, Alloc>;
+    using const_pointer = detail::detected_or_t<
+        ptr_rebind<pointer, const value_type>, detail::const_pointer_of, Alloc>;
+    using void_pointer = detail::detected_or_t<
+        ptr_rebind<pointer, void>, detail::void_pointer_of, Alloc>;
+    using const_void_pointer = detail::detected_or_t<
+        ptr_rebind<pointer, const void>, detail::const_void_pointer_of, Alloc>;
+    using difference_type = detail::detected_or_t<
+        typename pointer_traits<pointer>::difference_type, detail::difference_type_of, Alloc>;
+    using size_type = detail::detected_or_t<
+        std::make_unsigned_t<difference_type>, detail::size_type_of, Alloc>;
+
+    // ===========================================================
+    // Propagation policy (detected, with fallbacks)
+    // ===========================================================
+    using propagate_on_container_copy_assignment =
+        detail::detected_or_t<std::false_type, detail::pocca_of, Alloc>;
+    using propagate_on_container_move_assignment =
+        detail::detected_or_t<std::false_type, detail::pocma_of, Alloc>;
+    using propagate_on_container_swap =
+        detail::detected_or_t<std::false_type, detail::pocs_of, Alloc>;
+    using is_always_equal =
+        detail::detected_or_t<typename std::is_empty<Alloc>::type, detail::is_always_equal_of, Alloc>;
 
     // Rebind allocator to different type 
     template<typename U> 
-    using rebind_alloc = typename Alloc::template rebind<U>::other;
+    using rebind_alloc = typename detail::rebind_alloc_impl<Alloc, U>::type;
 
-    template<typename Y> 
+    template<typename U> 
     using rebind_traits = allocator_traits<rebind_alloc<U>>; 
 
     // ===========================================================
@@ -128,96 +257,173 @@ struct allocator_traits {
         return a.allocate(n);
     }
 
-    [[nodiscard]] static pointer allocate(Alloc& a, size_type n, const void* hint) {
-        // try to use hint if allocator provides it
-        return a.allocate(n); // Ignore hint in simple case
+    // use the hint if the allocator takes one
+    [[nodiscard]] static pointer allocate(Alloc& a, size_type n, const_void_pointer hint) {
+        return allocate_impl(0, a, n, hint);
     }
 
     // DEALLOCATE - Always required 
-    [[nodiscard]] static void deallocate(Alloc& a, pointer p, size_type n) noexcept {
+    static void deallocate(Alloc& a, pointer p, size_type n) noexcept {
         a.deallocate(p, n);
     }
 
     // CONSTRUCT - with SFINAE detection - Use allocator's if available, otherwise default 
     template<typename T, typename... Args> 
     static void construct(Alloc& a, T* p, Args&&... args) {
-        construct_impl(a, p, std::forward<Args>(args)...);
+        construct_impl(0, a, p, std::forward<Args>(args)...);
     }
 
     // DESTROY - with SFINAE detection 
     template<typename T> 
     static void destroy(Alloc& a, T* p) noexcept {
-        destroy_impl(a, p);
+        destroy_impl(0, a, p);
     }
 
     // Max size - with SFINAE detection 
-    [[nodiscard]] static size_type max_size(const Allocs& a) {
-        return max_size_impl(a);
+    [[nodiscard]] static size_type max_size(const Alloc& a) noexcept {
+        return max_size_impl(0, a);
     }
 
     // Copy construction policy - with SFINAE detection 
-    [[nodiscard]] static Alloc section_on_container_copy_construction(const Alloc& a) {
-        return select_impl(a);
+    [[nodiscard]] static Alloc select_on_container_copy_construction(const Alloc& a) {
+        return select_impl(0, a);
+    }
+
+    // ===========================================================
+    // Growth hooks (career extension, not in std::allocator_traits)
+    // ===========================================================
+
+    // Grow the block in place if the allocator knows how; otherwise false
+    static bool try_expand(Alloc& a, pointer p, size_type old_n, size_type new_n) noexcept {
+        return try_expand_impl(0, a, p, old_n, new_n);
+    }
+
+    // Move a trivially copyable buffer to new_n elements. Fallback:
+    // try_expand, else allocate + memcpy + deallocate.
+    [[nodiscard]] static pointer reallocate(Alloc& a, pointer p, size_type old_n, size_type new_n) {
+        return reallocate_impl(0, a, p, old_n, new_n);
     }
 
 private: 
+    // Overload priority: the `int` version (uses the allocator's member) is
+    // preferred for a literal 0; the `long` version is the fallback. Each
+    // impl is templated on A (always = Alloc) so the member lookup happens
+    // in the immediate context and a missing member is SFINAE, not an error.
+
+    // ================ allocate(hint) SFINAE ==============
+
+    template<typename A>
+    static auto allocate_impl(int, A& a, size_type n, const_void_pointer hint)
+    -> decltype(a.allocate(n, hint))
+    {
+        return a.allocate(n, hint);
+    }
+
+    template<typename A>
+    static pointer allocate_impl(long, A& a, size_type n, const_void_pointer)
+    {
+        return a.allocate(n);
+    }
+
+    // ================ try_expand SFINAE ==============
+
+    template<typename A>
+    static auto try_expand_impl(int, A& a, pointer p, size_type old_n, size_type new_n) noexcept
+    -> decltype(bool(a.try_expand(p, old_n, new_n)))
+    {
+        return a.try_expand(p, old_n, new_n);
+    }
+
+    template<typename A>
+    static bool try_expand_impl(long, A&, pointer, size_type, size_type) noexcept
+    {
+        return false;
+    }
+
+    // ================ reallocate SFINAE ==============
+
+    template<typename A>
+    static auto reallocate_impl(int, A& a, pointer p, size_type old_n, size_type new_n)
+    -> decltype(a.reallocate(p, old_n, new_n))
+    {
+        return a.reallocate(p, old_n, new_n);
+    }
+
+    template<typename A>
+    static pointer reallocate_impl(long, A& a, pointer p, size_type old_n, size_type new_n)
+    {
+        static_assert(std::is_trivially_copyable_v<value_type>,
+                      "reallocate moves bytes: value_type must be trivially copyable");
+        if (old_n && try_expand(a, p, old_n, new_n)) {
+            return p;
+        }
+        pointer q = a.allocate(new_n);
+        if (old_n) {
+            std::memcpy(static_cast<void*>(&*q), static_cast<const void*>(&*p),
+                        std::min(old_n, new_n) * sizeof(value_type));
+            a.deallocate(p, old_n);
+        }
+        return q;
+    }
+
     // ================ construct SFINAE ===============
 
-    template<typename T, typename... Args> 
-    static auto construct_impl(Alloc& a, T* p, Args&&... args) 
+    template<typename A, typename T, typename... Args> 
+    static auto construct_impl(int, A& a, T* p, Args&&... args) 
     -> decltype(a.construct(p, std::forward<Args>(args)...), void())
     {
         a.construct(p, std::forward<Args>(args)...);
     }
 
-    template<typename T, typename... Args> 
-    static auto construct_impl(..., T* p, Args&&... args) 
-    -> void 
+    template<typename A, typename T, typename... Args> 
+    static void construct_impl(long, A&, T* p, Args&&... args) 
     {
         ::new(static_cast<void*>(p)) T(std::forward<Args>(args)...);
     }
 
     // ================ destroy SFINAE ====================
 
-    template<typename T> 
-    static auto destroy_impl(Alloc& a, T* p) noexcept
+    template<typename A, typename T> 
+    static auto destroy_impl(int, A& a, T* p) noexcept
     -> decltype(a.destroy(p), void())
     {
         a.destroy(p); 
     }
 
-    template<typename T> 
-    static auto destroy_impl(..., T* p) noexcept 
-    -> void 
+    template<typename A, typename T> 
+    static void destroy_impl(long, A&, T* p) noexcept 
     {
         p->~T();
     }
 
     // ============= max_size SFINAE ======================
-    [[nodiscard]] static auto max_size(const Allocs& a) 
-    ->  decltype(a.max_size())
+    template<typename A>
+    static auto max_size_impl(int, const A& a) noexcept
+    -> decltype(a.max_size())
     {
         return a.max_size();
     }
 
-    [[nodiscard]] static auto max_size(...) 
-    ->  size_type
+    template<typename A>
+    static size_type max_size_impl(long, const A&) noexcept
     {
         return std::numeric_limits<size_type>::max() / sizeof(value_type);
     }
 
-    // ============= section_on_container_copy_construction SFINAE ======================
-    [[nodiscard]] static auto section_on_container_copy_construction(const Alloc& a)
-    -> decltype(a.section_on_container_copy_construction()) 
+    // ============= select_on_container_copy_construction SFINAE ======================
+    template<typename A>
+    static auto select_impl(int, const A& a)
+    -> decltype(a.select_on_container_copy_construction())
     {
-        return a.section_on_container_copy_construction();
+        return a.select_on_container_copy_construction();
     }
 
-    [[nodiscard]] static auto section_on_container_copy_construction(...)
-    -> decltype(Alloc) 
+    // Default: the copy shares the source's allocator (same arena, same pool)
+    template<typename A>
+    static Alloc select_impl(long, const A& a)
     {
-       return Alloc{}; 
+        return a; 
     }
 }; 
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace career {
+
+// ============================================================================
+// Arena - monotonic bump-pointer memory with chained blocks
+// ============================================================================
+//
+//   _head -> [Block 3 | used....|cur      end]    (newest, we bump in here)
+//               next
+//                 -> [Block 2 | used.............]
+//                      next
+//                        -> [Block 1 | used......]  -> null
+//
+// allocate   = align _cur, bump it by `bytes`; new block only when full
+// deallocate = nothing (there is no per-object free)
+// reset()    = drop everything at once; the oldest block is kept so the
+//              next request doesn't start with a malloc
+// Scope      = RAII checkpoint: rewinds to where the arena was when the
+//              Scope was created (nested per-request lifetimes)
+//
+// Ideal for request-lifetime data: build lots of temporary containers and
+// strings during a request, then throw them all away with one reset().
+// Destructors still run (containers call them), only the memory is bulk
+// released.
+//
+// NOT thread-safe: one arena per request / per thread.
+
+class Arena {
+    struct Block;
+
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit Arena(size_t block_size = DEFAULT_BLOCK_SIZE) noexcept
+        : _block_size(block_size) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() {
+        release_until(nullptr);
+    }
+
+    // ┌─────────────────────────────────────────────────────────────────────┐
+    // │ allocate: the hot path is one align + one compare + one add          │
+    // └─────────────────────────────────────────────────────────────────────┘
+    [[nodiscard]] void* allocate(size_t bytes, size_t align = alignof(std::max_align_t)) {
+        unsigned char* p = align_up(_cur, align);
+        if (!_head || p > _end || bytes > size_t(_end - p)) {
+            // add_block needs sizeof(Block) + bytes + align to fit a size_t
+            if (bytes > SIZE_MAX - sizeof(Block) - align) {
+                throw std::bad_alloc();
+            }
+            add_block(bytes + align);
+            p = align_up(_cur, align);
+        }
+        _cur = p + bytes;
+        return p;
+    }
+
+    // Release everything at once (keeps the oldest block for reuse)
+    void reset() noexcept {
+        if (!_head) {
+            return;
+        }
+        Block* oldest = _head;
+        while (oldest->next) {
+            oldest = oldest->next;
+        }
+        release_until(oldest);
+        _cur = oldest->data();
+    }
+
+    // Bytes handed out since construction / last reset (including padding)
+    size_t bytes_used() const noexcept {
+        size_t total = 0;
+        for (Block* b = _head; b; b = b->next) {
+            total += (b == _head ? size_t(_cur - b->data()) : b->size);
+        }
+        return total;
+    }
+
+    // ┌─────────────────────────────────────────────────────────────────────┐
+    // │ Scope: rewind the arena when the scope ends                          │
+    // │                                                                      │
+    // │   void handle(const Request& req, Arena& arena) {                    │
+    // │       Arena::Scope request_scope(arena);                             │
+    // │       std::vector<int, arena_allocator<int>> ids{                    │
+    // │           arena_allocator<int>(arena)};                              │
+    // │       ...                                                            │
+    // │   }   // ids destroyed first, then the arena rewinds                 │
+    // └─────────────────────────────────────────────────────────────────────┘
+    class Scope {
+    public:
+        explicit Scope(Arena& arena) noexcept
+            : _arena(arena), _block(arena._head), _cur(arena._cur) {}
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope() {
+            _arena.release_until(_block);
+            _arena._cur = _cur;
+        }
+
+    private:
+        Arena& _arena;
+        Block* _block;
+        unsigned char* _cur;
+    };
+
+private:
+    struct Block {
+        Block* next;
+        size_t size;  // usable bytes after the header
+
+        unsigned char* data() noexcept {
+            return reinterpret_cast<unsigned char*>(this + 1);
+        }
+    };
+
+    Block* _head = nullptr;
+    unsigned char* _cur = nullptr;
+    unsigned char* _end = nullptr;
+    size_t _block_size;
+
+    static unsigned char* align_up(unsigned char* p, size_t align) noexcept {
+        const uintptr_t v = reinterpret_cast<uintptr_t>(p);
+        return reinterpret_cast<unsigned char*>((v + align - 1) & ~uintptr_t(align - 1));
+    }
+
+    void add_block(size_t min_bytes) {
+        const size_t size = min_bytes > _block_size ? min_bytes : _block_size;
+        void* raw = ::operator new(sizeof(Block) + size);
+        Block* block = ::new (raw) Block{_head, size};
+        _head = block;
+        _cur = block->data();
+        _end = _cur + size;
+    }
+
+    // Free blocks newer than `keep` (nullptr = free all); `keep` becomes current
+    void release_until(Block* keep) noexcept {
+        while (_head && _head != keep) {
+            Block* next = _head->next;
+            ::operator delete(_head, sizeof(Block) + _head->size);
+            _head = next;
+        }
+        if (_head) {
+            _end = _head->data() + _head->size;
+        } else {
+            _cur = _end = nullptr;
+        }
+    }
+};
+
+// ============================================================================
+// arena_allocator<T> - a (stateful) allocator view of an Arena
+// ============================================================================
+//
+// Holds an Arena*. Two arena_allocators are equal iff they use the same
+// arena - memory from one arena can't be "freed" into another, so the
+// allocator has to travel with the container's memory:
+//   propagate_on_container_copy_assignment / move_assignment / swap = true
+//   is_always_equal = false
+// allocator_traits reads these to decide e.g. whether move-assignment can
+// just steal the buffer.
+//
+//   Arena arena;
+//   using arena_string = std::basic_string<char, std::char_traits<char>,
+//                                          arena_allocator<char>>;
+//   arena_string s("temporary", arena_allocator<char>(arena));
+
+template<typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind {
+        using other = arena_allocator<U>;
+    };
+
+    explicit arena_allocator(Arena& arena) noexcept : _arena(&arena) {}
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept : _arena(other.arena()) {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // No-op: memory goes back when the arena is reset / rewound / destroyed
+    void deallocate(T*, size_type) noexcept {}
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return size_type(-1) / sizeof(T);
+    }
+
+    Arena* arena() const noexcept {
+        return _arena;
+    }
+
+private:
+    Arena* _arena;
+};
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>& a, const arena_allocator<U>& b) noexcept {
+    return a.arena() == b.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>& a, const arena_allocator<U>& b) noexcept {
+    return !(a == b);
+}
+
+} // namespace career
@@ -0,0 +1,94 @@
+// allocator_benchmark.cpp
+// career::allocator: sized delete and over-aligned allocation
+//
+//   legacy     : ::operator new(bytes) / ::operator delete(p)        (old path)
+//   career     : career::allocator<T>  -> sized delete, align_val_t when needed
+//
+// Two things to look at:
+//   1. ns per allocate+deallocate pair. The sized-delete win depends on the
+//      malloc: glibc's free() ignores the size, so expect a tie there. Run
+//      with a size-class allocator to see it, e.g.
+//          LD_PRELOAD=libtcmalloc.so ./program.exe
+//   2. "misaligned": how many blocks of an alignas(64) type did NOT come
+//      back 64-byte aligned. The legacy path silently gets this wrong.
+//
+// Build: g++ -std=c++17 -O2 allocator_benchmark.cpp -o program.exe
+
+#include "../allocator_traits.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace std::chrono;
+
+struct alignas(64) CacheLineCounter {
+    long long value;
+};
+
+constexpr size_t BLOCKS = 4096;   // live blocks per round
+constexpr int ROUNDS = 200;
+
+volatile uintptr_t g_sink = 0;
+
+struct Result {
+    double ns;
+    size_t misaligned;
+};
+
+template<typename T>
+struct LegacyAllocator {
+    T* allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T))); }
+    void deallocate(T* p, size_t) noexcept { ::operator delete(p); }
+};
+
+// Allocate BLOCKS blocks of n elements, then free them in a strided
+// order (so the allocator can't just pop/push one hot free-list slot).
+template<typename T, typename Alloc>
+static Result churn(size_t n) {
+    Alloc alloc;
+    std::vector<T*> blocks(BLOCKS);
+    size_t misaligned = 0;
+
+    auto start = steady_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (size_t i = 0; i < BLOCKS; i++) {
+            blocks[i] = alloc.allocate(n);
+            misaligned += (reinterpret_cast<uintptr_t>(blocks[i]) % alignof(T)) != 0;
+        }
+        g_sink = g_sink + reinterpret_cast<uintptr_t>(blocks[r % BLOCKS]);
+        for (size_t i = 0; i < BLOCKS; i++) {
+            alloc.deallocate(blocks[(i * 7) % BLOCKS], n);
+        }
+    }
+    const double elapsed = double(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    return {elapsed / (double(BLOCKS) * ROUNDS), misaligned};
+}
+
+template<typename T>
+static void row(const char* type_name, size_t n) {
+    Result legacy = churn<T, LegacyAllocator<T>>(n);
+    Result sized = churn<T, career::allocator<T>>(n);
+    std::printf("%-20s n=%-4zu legacy %6.2f ns (misaligned %6zu)   career %6.2f ns (misaligned %zu)\n",
+                type_name, n, legacy.ns, legacy.misaligned, sized.ns, sized.misaligned);
+}
+
+int main() {
+    row<int>("int", 1);
+    row<int>("int", 16);
+    row<int>("int", 256);
+    row<CacheLineCounter>("alignas(64) counter", 1);
+    row<CacheLineCounter>("alignas(64) counter", 16);
+}
+
+/*
+g++ 12, -O2, x86-64, glibc malloc (free() ignores the size -> tie expected):
+int                  n=1    legacy  27.81 ns (misaligned      0)   career  28.60 ns (misaligned 0)
+int                  n=16   legacy  23.32 ns (misaligned      0)   career  24.41 ns (misaligned 0)
+int                  n=256  legacy 639.67 ns (misaligned      0)   career 652.62 ns (misaligned 0)
+alignas(64) counter  n=1    legacy  29.69 ns (misaligned 614200)   career 106.97 ns (misaligned 0)
+alignas(64) counter  n=16   legacy 717.32 ns (misaligned 613801)   career 870.52 ns (misaligned 0)
+The aligned path costs more under glibc (aligned_alloc), but the legacy
+path hands back misaligned memory for the alignas(64) type.
+*/
@@ -0,0 +1,86 @@
+// arena_allocator_benchmark.cpp
+// Request-lifetime temporaries: std::allocator vs career::arena_allocator
+//
+// Each "request" builds a vector of strings and a map of counters, then
+// throws all of it away. With std::allocator every node and string buffer
+// is freed one by one; with the arena the containers' deallocate() calls
+// are no-ops and one Arena::Scope rewind releases the whole request.
+//
+// Build: g++ -std=c++17 -O2 arena_allocator_benchmark.cpp -o program.exe
+
+#include "../arena_allocator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std::chrono;
+
+constexpr int REQUESTS = 20000;
+constexpr int FIELDS = 64;   // temporaries per request
+
+volatile size_t g_sink = 0;
+
+template<typename Body>
+static double ms(Body&& body) {
+    auto start = steady_clock::now();
+    body();
+    return double(duration_cast<microseconds>(steady_clock::now() - start).count()) / 1000.0;
+}
+
+// One request, generic over the allocator. make<T>() hands out an allocator.
+template<template<typename> class Alloc, typename Make>
+static void handle_request(int id, Make make) {
+    using string = std::basic_string<char, std::char_traits<char>, Alloc<char>>;
+    using entry = std::pair<const string, int>;
+
+    std::vector<string, Alloc<string>> fields(make.template operator()<string>());
+    std::map<string, int, std::less<string>, Alloc<entry>> counts(make.template operator()<entry>());
+
+    for (int i = 0; i < FIELDS; i++) {
+        string s("header-field-with-a-longish-name-", make.template operator()<char>());
+        s += char('a' + (id + i) % 26);
+        fields.push_back(s);
+        counts[s] += i;
+    }
+    g_sink = g_sink + fields.size() + counts.size();
+}
+
+struct MakeStd {
+    template<typename T>
+    std::allocator<T> operator()() const { return {}; }
+};
+
+struct MakeArena {
+    career::Arena* arena;
+    template<typename T>
+    career::arena_allocator<T> operator()() const { return career::arena_allocator<T>(*arena); }
+};
+
+int main() {
+    const double heap = ms([] {
+        for (int r = 0; r < REQUESTS; r++) {
+            handle_request<std::allocator>(r, MakeStd{});
+        }
+    });
+
+    career::Arena arena;
+    const double bump = ms([&] {
+        for (int r = 0; r < REQUESTS; r++) {
+            career::Arena::Scope request_scope(arena);
+            handle_request<career::arena_allocator>(r, MakeArena{&arena});
+        }
+    });
+
+    std::printf("%d requests x %d fields: std::allocator %7.1f ms   arena_allocator %7.1f ms\n",
+                REQUESTS, FIELDS, heap, bump);
+}
+
+/*
+g++ 12, -O2, x86-64, glibc malloc:
+20000 requests x 64 fields: std::allocator   246.6 ms   arena_allocator    84.3 ms
+*/
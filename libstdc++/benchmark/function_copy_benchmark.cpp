@@ -0,0 +1,67 @@
+// function_copy_benchmark.cpp
+// Copy-heavy workload: how expensive is it to copy/move/destroy a
+// career::function, depending on what it holds?
+//
+//   - plain function pointer   -> trivial mode (no manager)
+//   - captureless lambda       -> trivial mode (no manager)
+//   - small capturing lambda   -> SBO + _manage_small
+//   - large capturing lambda   -> heap + _manage_large
+//
+// Build: g++ -std=c++17 -O2 function_copy_benchmark.cpp -o program.exe
+
+#include "../function.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std::chrono;
+
+static int add_one(int x) { return x + 1; }
+
+// Copy one function N times into a vector (fan-out), then copy the whole
+// vector again (copy-assignment path), then let everything be destroyed.
+template<typename Fn>
+static void bench(const char* name, const Fn& fn, size_t n, int rounds) {
+    using ns = nanoseconds;
+    long long sink = 0;
+
+    auto start = steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        std::vector<career::function<int(int)>> subscribers(n, fn);
+        std::vector<career::function<int(int)>> copies = subscribers;
+        sink += copies[r % n](r);
+    }
+    auto elapsed = duration_cast<ns>(steady_clock::now() - start).count();
+
+    // 2n copies + 2n destroys per round
+    std::printf("%-24s %8.2f ns/copy+destroy   (sink %lld)\n",
+                name, double(elapsed) / (2.0 * n * rounds), sink);
+}
+
+int main() {
+    const size_t n = 1000;
+    const int rounds = 2000;
+
+    std::string payload(64, 'x');
+
+    career::function<int(int)> fnptr(&add_one);
+    career::function<int(int)> stateless([](int x) { return x * 2; });
+    int k = 3;
+    career::function<int(int)> small([k](int x) { return x + k; });
+    career::function<int(int)> large([payload](int x) { return x + int(payload.size()); });
+
+    bench("function pointer", fnptr, n, rounds);
+    bench("captureless lambda", stateless, n, rounds);
+    bench("small capture (SBO)", small, n, rounds);
+    bench("large capture (heap)", large, n, rounds);
+}
+
+/*
+g++ 12, -O2, x86-64 (before -> after trivial mode):
+function pointer             8.89 ->   4.74 ns/copy+destroy
+captureless lambda           9.69 ->   4.36 ns/copy+destroy
+small capture (SBO)          8.32 ->   8.31 ns/copy+destroy
+large capture (heap)       134.53 -> 131.09 ns/copy+destroy
+*/
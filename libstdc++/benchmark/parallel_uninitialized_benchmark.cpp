@@ -0,0 +1,102 @@
+// parallel_uninitialized_benchmark.cpp
+// Bandwidth of uninitialized_copy / fill / move / destroy: seq vs par
+//
+// 512 MiB of 32-byte records (trivially copyable, so every chunk is one
+// memmove or one SIMD fill) plus 64 MiB of std::string for the non-trivial
+// copy/destroy path. Reported as GB/s of destination written.
+//
+//   seq : one thread - bounded by a single core's load/store throughput
+//   par : one chunk per hardware thread, each running the sequential kernel
+//
+// Build: g++ -std=c++17 -O2 -pthread parallel_uninitialized_benchmark.cpp -o program.exe
+
+#include "../parallel_uninitialized.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+using namespace std::chrono;
+namespace ex = career::execution;
+
+struct Record {
+    long long id;
+    double x, y, z;
+};
+
+constexpr size_t BYTES = size_t(512) << 20;
+constexpr size_t N = BYTES / sizeof(Record);
+constexpr size_t STRINGS = (size_t(64) << 20) / sizeof(std::string);
+constexpr int REPS = 5;
+
+volatile long long g_sink = 0;
+
+template<typename Body>
+static double gbps(size_t bytes, Body&& body) {
+    auto start = steady_clock::now();
+    for (int r = 0; r < REPS; r++) body();
+    const double s = double(duration_cast<nanoseconds>(steady_clock::now() - start).count()) / 1e9;
+    return double(bytes) * REPS / s / 1e9;
+}
+
+template<typename Policy>
+static void run(const char* name, Policy policy, Record* src, Record* dst, std::string* strs, std::string* sdst) {
+    const Record r{1, 2, 3, 4};
+    const double copy = gbps(BYTES, [&] {
+        career::uninitialized_copy(policy, src, src + N, dst);
+        g_sink = g_sink + dst[N - 1].id;
+    });
+    const double fill = gbps(BYTES, [&] {
+        career::uninitialized_fill(policy, dst, dst + N, r);
+        g_sink = g_sink + dst[N - 1].id;
+    });
+    const double move = gbps(BYTES, [&] {
+        career::uninitialized_move(policy, src, src + N, dst);
+        g_sink = g_sink + dst[N - 1].id;
+    });
+    const double strings = gbps(STRINGS * sizeof(std::string), [&] {
+        career::uninitialized_copy(policy, strs, strs + STRINGS, sdst);
+        career::destroy(policy, sdst, sdst + STRINGS);
+    });
+    std::printf("%-4s copy %6.2f  fill %6.2f  move %6.2f  string copy+destroy %6.2f  GB/s\n", name, copy, fill,
+                move, strings);
+}
+
+int main() {
+    Record* src = static_cast<Record*>(std::malloc(BYTES));
+    Record* dst = static_cast<Record*>(std::malloc(BYTES));
+    std::memset(static_cast<void*>(src), 1, BYTES);   // fault the pages in up front
+    std::memset(static_cast<void*>(dst), 1, BYTES);
+
+    std::string* strs = static_cast<std::string*>(std::malloc(STRINGS * sizeof(std::string)));
+    std::string* sdst = static_cast<std::string*>(std::malloc(STRINGS * sizeof(std::string)));
+    career::uninitialized_fill(strs, strs + STRINGS, std::string("short"));
+
+    std::printf("512 MiB records, %zu strings, %u hardware threads\n", STRINGS, std::thread::hardware_concurrency());
+    run("seq", ex::seq, src, dst, strs, sdst);
+    run("par", ex::par, src, dst, strs, sdst);
+    run("par4", ex::par(4), src, dst, strs, sdst);
+
+    career::destroy(strs, strs + STRINGS);
+    std::free(sdst);
+    std::free(strs);
+    std::free(dst);
+    std::free(src);
+}
+
+/*
+g++ 12, -O2, x86-64, glibc malloc, 1-CPU VM:
+512 MiB records, 2097152 strings, 1 hardware threads
+seq  copy   7.94  fill   7.59  move   8.17  string copy+destroy   1.56  GB/s
+par  copy   8.31  fill   7.91  move   8.33  string copy+destroy   2.47  GB/s
+par4 copy   8.60  fill   8.15  move   9.46  string copy+destroy   3.21  GB/s
+With one CPU, par has nothing to spread over: the columns match within
+noise. The string column climbs from run to run as malloc's free lists
+warm up. par4 forces four threads onto the single core and shows that the
+chunking overhead is lost in the noise. Expect the record columns to scale
+toward the socket's memory bandwidth on a multi-core machine; that was
+not measured here.
+*/
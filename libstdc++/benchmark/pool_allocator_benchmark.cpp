@@ -0,0 +1,62 @@
+// pool_allocator_benchmark.cpp
+// Node-based containers: general-purpose malloc vs career::pool_allocator
+//
+// std::list / std::map allocate one small node per element, which is the
+// worst case for malloc and the best case for a size-class free list.
+//
+// Build: g++ -std=c++17 -O2 pool_allocator_benchmark.cpp -o program.exe
+
+#include "../pool_allocator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+
+using namespace std::chrono;
+
+constexpr int ELEMENTS = 200000;
+constexpr int ROUNDS = 20;
+
+template<typename Body>
+static double ms(Body&& body) {
+    auto start = steady_clock::now();
+    body();
+    return double(duration_cast<microseconds>(steady_clock::now() - start).count()) / 1000.0;
+}
+
+template<template<typename> class Alloc>
+static double list_churn() {
+    return ms([] {
+        for (int r = 0; r < ROUNDS; r++) {
+            std::list<int, Alloc<int>> xs;
+            for (int i = 0; i < ELEMENTS; i++) xs.push_back(i);
+            for (int i = 0; i < ELEMENTS / 2; i++) xs.pop_front();
+        }
+    });
+}
+
+template<template<typename> class Alloc>
+static double map_churn() {
+    return ms([] {
+        for (int r = 0; r < ROUNDS / 4; r++) {
+            std::map<int, int, std::less<int>, Alloc<std::pair<const int, int>>> m;
+            for (int i = 0; i < ELEMENTS; i++) m.emplace((i * 7919) % ELEMENTS, i);
+        }
+    });
+}
+
+int main() {
+    std::printf("std::list  push/pop : std::allocator %7.1f ms   pool_allocator %7.1f ms\n",
+                list_churn<std::allocator>(), list_churn<career::pool_allocator>());
+    std::printf("std::map   insert   : std::allocator %7.1f ms   pool_allocator %7.1f ms\n",
+                map_churn<std::allocator>(), map_churn<career::pool_allocator>());
+}
+
+/*
+g++ 12, -O2, x86-64, glibc malloc:
+std::list  push/pop : std::allocator   120.0 ms   pool_allocator    34.2 ms
+std::map   insert   : std::allocator   650.5 ms   pool_allocator   396.3 ms
+*/
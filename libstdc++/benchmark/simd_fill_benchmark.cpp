@@ -0,0 +1,81 @@
+// simd_fill_benchmark.cpp
+// Initializing a big buffer: scalar loop / memset vs career's SIMD fill
+//
+// Fills a 256 MiB buffer of 8-byte Pixels (a non-zero pattern memset can't
+// do) and of zeros:
+//
+//   loop / memset : regular stores - every destination line is read into
+//                   the cache (read-for-ownership) before it's overwritten
+//   career        : AVX2/SSE2 non-temporal stores past 4 MiB, which write
+//                   whole lines straight to memory
+//
+// Build: g++ -std=c++17 -O2 simd_fill_benchmark.cpp -o program.exe
+
+#include "../uninitialized.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std::chrono;
+
+struct Pixel {
+    unsigned char r, g, b, a;
+    float depth;
+};
+
+constexpr size_t BYTES = size_t(256) << 20;
+constexpr size_t N = BYTES / sizeof(Pixel);
+constexpr int REPS = 10;
+
+volatile long g_sink = 0;
+
+template<typename Fill>
+static void run(const char* name, Fill&& fill) {
+    auto start = steady_clock::now();
+    for (int r = 0; r < REPS; r++) fill();
+    const double s = double(duration_cast<nanoseconds>(steady_clock::now() - start).count()) / 1e9;
+    std::printf("%-18s %6.2f GB/s\n", name, double(BYTES) * REPS / s / 1e9);
+}
+
+int main() {
+    Pixel* buf = static_cast<Pixel*>(std::malloc(BYTES));
+    std::memset(buf, 1, BYTES);   // fault the pages in up front
+
+    const Pixel grey{128, 128, 128, 255, 1.0f};
+    const Pixel zero{};
+
+    std::printf("256 MiB fill x %d, simd level %d (0 none, 1 sse2, 2 avx2)\n", REPS,
+                int(career::detail::simd_support()));
+    run("pattern: loop", [&] {
+        for (size_t i = 0; i < N; i++) ::new (static_cast<void*>(buf + i)) Pixel(grey);
+        g_sink = g_sink + buf[N - 1].r;
+    });
+    run("pattern: career", [&] {
+        career::uninitialized_fill_n(buf, N, grey);
+        g_sink = g_sink + buf[N - 1].r;
+    });
+    run("zero:    memset", [&] {
+        std::memset(static_cast<void*>(buf), 0, BYTES);
+        g_sink = g_sink + buf[N - 1].r;
+    });
+    run("zero:    career", [&] {
+        career::uninitialized_fill_n(buf, N, zero);
+        g_sink = g_sink + buf[N - 1].r;
+    });
+
+    std::free(buf);
+}
+
+/*
+g++ 12, -O2, x86-64 (AVX2), glibc 2.36, Linux:
+256 MiB fill x 10, simd level 2 (0 none, 1 sse2, 2 avx2)
+pattern: loop        6.35 GB/s
+pattern: career     14.46 GB/s
+zero:    memset      7.92 GB/s
+zero:    career     15.12 GB/s
+Skipping the read-for-ownership roughly halves the memory traffic, which
+is where the ~2x comes from. Below 4 MiB career keeps memset / cached
+stores, because the data is likely to be read again soon.
+*/
@@ -0,0 +1,132 @@
+// thread_cache_benchmark.cpp
+// Producer/consumer: allocate on one thread, free on another
+//
+// PRODUCERS threads each allocate MESSAGES 64-byte messages and hand them
+// to one consumer over SPSC rings; the consumer reads and frees them. This
+// is a pipeline stage boundary - every free is a cross-thread free.
+//
+//   career::allocator       : malloc/free, remote frees go through malloc's
+//                             arena locks
+//   thread_cache_allocator  : remote frees are batched (32 per CAS) back to
+//                             the producer's cache, which reuses them
+//
+// Build: g++ -std=c++17 -O2 -pthread thread_cache_benchmark.cpp -o program.exe
+
+#include "../thread_cache_allocator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+
+constexpr int PRODUCERS = 3;
+constexpr size_t MESSAGES = 2000000;   // per producer
+constexpr size_t RING = 1024;          // power of two
+
+struct Message {
+    long long payload[8];              // 64 B
+};
+
+volatile long long g_sink = 0;
+
+// Single-producer single-consumer ring of Message*
+struct Ring {
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    Message* slots[RING];
+
+    bool push(Message* m) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == RING) return false;
+        slots[t & (RING - 1)] = m;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    Message* pop() {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return nullptr;
+        Message* m = slots[h & (RING - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return m;
+    }
+};
+
+// Before going idle, send any half-full batch of remote frees back to the
+// producers - they may be waiting on those blocks
+template<typename Alloc>
+static void flush_frees(const Alloc&) {}
+
+template<typename T>
+static void flush_frees(const career::thread_cache_allocator<T>&) {
+    career::thread_cache_allocator<T>::flush();
+}
+
+template<typename Alloc>
+static double pipeline_ms() {
+    std::vector<std::unique_ptr<Ring>> rings;
+    for (int i = 0; i < PRODUCERS; i++) rings.push_back(std::make_unique<Ring>());
+
+    auto start = steady_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int id = 0; id < PRODUCERS; id++) {
+        producers.emplace_back([&rings, id] {
+            Alloc alloc;
+            for (size_t i = 0; i < MESSAGES; i++) {
+                Message* m = alloc.allocate(1);
+                m->payload[0] = (long long)i;
+                while (!rings[id]->push(m)) std::this_thread::yield();
+            }
+        });
+    }
+
+    std::thread consumer([&rings] {
+        Alloc alloc;
+        long long sum = 0;
+        size_t done = 0;
+        while (done < MESSAGES * PRODUCERS) {
+            bool idle = true;
+            for (auto& ring : rings) {
+                while (Message* m = ring->pop()) {
+                    sum += m->payload[0];
+                    alloc.deallocate(m, 1);
+                    done++;
+                    idle = false;
+                }
+            }
+            if (idle) {
+                flush_frees(alloc);
+                std::this_thread::yield();
+            }
+        }
+        g_sink = g_sink + sum;
+    });
+
+    for (auto& t : producers) t.join();
+    consumer.join();
+    return double(duration_cast<microseconds>(steady_clock::now() - start).count()) / 1000.0;
+}
+
+int main() {
+    std::printf("%d producers x %zu msgs -> 1 consumer (cpus: %u)\n", PRODUCERS, MESSAGES,
+                std::thread::hardware_concurrency());
+    std::printf("career::allocator       %8.1f ms\n", pipeline_ms<career::allocator<Message>>());
+    std::printf("thread_cache_allocator  %8.1f ms\n", pipeline_ms<career::thread_cache_allocator<Message>>());
+}
+
+/*
+g++ 12, -O2, x86-64, glibc malloc, 1-CPU VM (threads time-slice, so this
+shows the per-op cost, not lock contention - expect a wider gap on real
+cores):
+3 producers x 2000000 msgs -> 1 consumer (cpus: 1)
+career::allocator          330.8 ms
+thread_cache_allocator      86.9 ms
+The consumer calls thread_cache_allocator::flush() whenever it finds the
+rings empty, so a half-full batch never strands blocks its producer
+could be reusing.
+*/
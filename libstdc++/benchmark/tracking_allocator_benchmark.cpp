@@ -0,0 +1,136 @@
+// tracking_allocator_benchmark.cpp
+// tracking_allocator: does it count right, and what does counting cost?
+//
+// Part 1 replays allocation sequences whose totals are known and checks
+// the report against them:
+//
+//   growth  : std::vector<int> pushed to 1024 - libstdc++ doubles from 1,
+//             so 11 allocations; the high-water mark is 1024 + 512 ints
+//             (new buffer + old buffer during the last reallocation)
+//   threads : THREADS threads each allocate and free a known set of blocks
+//             under one tag - the merged report must add up
+//
+// Part 2 times an allocate/deallocate pair with and without the adaptor.
+//
+// Build: g++ -std=c++17 -O2 -pthread tracking_allocator_benchmark.cpp -o program.exe
+
+#include "../tracking_allocator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+
+constexpr int THREADS = 4;
+constexpr int BLOCKS = 1000;           // per thread
+constexpr int PAIRS = 10000000;
+
+volatile size_t g_sink = 0;
+
+static int g_failures = 0;
+
+static void check(const char* what, long long got, long long want) {
+    const bool ok = got == want;
+    std::printf("  %-28s %10lld  (want %lld)%s\n", what, got, want, ok ? "" : "  <-- FAIL");
+    if (!ok) {
+        g_failures++;
+    }
+}
+
+struct GrowthSite {};
+struct ThreadsSite {};
+struct TimingSite {};
+
+static void check_growth() {
+    using Alloc = career::tracking_allocator<career::allocator<int>, GrowthSite>;
+    std::printf("growth: std::vector<int> to 1024\n");
+    {
+        std::vector<int, Alloc> v;
+        for (int i = 0; i < 1024; i++) {
+            v.push_back(i);
+        }
+        const career::allocation_report r = Alloc::report();
+        check("allocations", r.allocations, 11);
+        check("deallocations", r.deallocations, 10);
+        check("bytes in use", r.bytes_in_use, 1024 * 4);
+        check("peak bytes", r.peak_bytes, (1024 + 512) * 4);
+        check("requests <= 16 B", r.histogram[0], 3);   // 4, 8, 16
+        check("requests <= 4096 B", r.histogram[8], 1);
+    }
+    const career::allocation_report r = Alloc::report();
+    check("deallocations after scope", r.deallocations, 11);
+    check("bytes in use after scope", r.bytes_in_use, 0);
+    r.print("growth");
+}
+
+// Thread t allocates BLOCKS blocks of (t + 1) * 8 bytes, all live at once,
+// then frees them; the threads run one after another, so the peak is the
+// biggest single thread's set
+static void check_threads() {
+    using Alloc = career::tracking_allocator<career::allocator<char>, ThreadsSite>;
+    std::printf("threads: %d x %d blocks\n", THREADS, BLOCKS);
+    for (int t = 0; t < THREADS; t++) {
+        std::thread([t] {
+            Alloc alloc;
+            const size_t n = size_t(t + 1) * 8;
+            std::vector<char*> live;
+            for (int i = 0; i < BLOCKS; i++) {
+                live.push_back(alloc.allocate(n));
+            }
+            for (char* p : live) {
+                alloc.deallocate(p, n);
+            }
+        }).join();
+    }
+    const career::allocation_report r = Alloc::report();
+    check("allocations", r.allocations, THREADS * BLOCKS);
+    check("deallocations", r.deallocations, THREADS * BLOCKS);
+    check("bytes in use", r.bytes_in_use, 0);
+    check("peak bytes", r.peak_bytes, (long long)THREADS * 8 * BLOCKS);
+    check("requests <= 16 B", r.histogram[0], 2 * BLOCKS);   // 8, 16
+    check("requests <= 32 B", r.histogram[1], 2 * BLOCKS);   // 24, 32
+}
+
+template<typename Alloc>
+static double ns_per_pair() {
+    Alloc alloc;
+    auto start = steady_clock::now();
+    for (int i = 0; i < PAIRS; i++) {
+        auto* p = alloc.allocate(4);
+        g_sink = g_sink + reinterpret_cast<size_t>(p);
+        alloc.deallocate(p, 4);
+    }
+    return duration<double, std::nano>(steady_clock::now() - start).count() / PAIRS;
+}
+
+int main() {
+    check_growth();
+    check_threads();
+
+    std::printf("\nallocate + deallocate of 16 B, %d pairs\n", PAIRS);
+    std::printf("career::allocator            %6.2f ns\n", ns_per_pair<career::allocator<int>>());
+    std::printf("tracking_allocator<...>      %6.2f ns\n",
+                ns_per_pair<career::tracking_allocator<career::allocator<int>, TimingSite>>());
+
+    if (g_failures) {
+        std::printf("\n%d check(s) FAILED\n", g_failures);
+    }
+    return g_failures ? 1 : 0;
+}
+
+/*
+g++ 12, -O2, x86-64, glibc malloc (part 1 abridged - every check passes):
+growth: std::vector<int> to 1024
+  peak bytes                         6144  (want 6144)
+threads: 4 x 1000 blocks
+  peak bytes                        32000  (want 32000)
+
+allocate + deallocate of 16 B, 10000000 pairs
+career::allocator             22.45 ns
+tracking_allocator<...>       26.11 ns
+When peaks were taken only at the 64 KiB flush, these two read 4096 (the
+current size) and 0: a container that never crossed FLUSH_BYTES never
+recorded its real high-water mark.
+*/
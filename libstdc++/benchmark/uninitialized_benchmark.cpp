@@ -0,0 +1,107 @@
+// uninitialized_benchmark.cpp
+// Element-by-element placement new vs the memmove/memset fast paths
+//
+// Copies, fills and value-initializes a 64 MiB buffer of a trivially
+// copyable struct many times:
+//
+//   loop     : placement new per element inside try/catch - the generic
+//              career::uninitialized_* path
+//   career   : the same calls on raw pointers, which now dispatch to
+//              memmove / memset
+//
+// Build: g++ -std=c++17 -O2 uninitialized_benchmark.cpp -o program.exe
+
+#include "../uninitialized.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace std::chrono;
+
+struct Pixel {
+    unsigned char r, g, b, a;
+    float depth;
+};
+
+constexpr size_t N = (size_t(64) << 20) / sizeof(Pixel);
+constexpr int REPS = 20;
+
+volatile float g_sink = 0;
+
+// The pre-dispatch generic loop, kept here as the baseline
+template<typename InputIt, typename ForwardIt>
+ForwardIt loop_copy(InputIt first, InputIt last, ForwardIt d_first) {
+    ForwardIt current = d_first;
+    try {
+        for (; first != last; ++first, ++current) {
+            ::new (static_cast<void*>(current)) Pixel(*first);
+        }
+        return current;
+    } catch (...) {
+        throw;
+    }
+}
+
+template<typename ForwardIt>
+void loop_fill(ForwardIt first, ForwardIt last, const Pixel& value) {
+    for (; first != last; ++first) {
+        ::new (static_cast<void*>(first)) Pixel(value);
+    }
+}
+
+template<typename ForwardIt>
+void loop_value_construct(ForwardIt first, ForwardIt last) {
+    for (; first != last; ++first) {
+        ::new (static_cast<void*>(first)) Pixel();
+    }
+}
+
+template<typename Body>
+static double ms(Body&& body) {
+    auto start = steady_clock::now();
+    for (int r = 0; r < REPS; r++) body(r);
+    return double(duration_cast<microseconds>(steady_clock::now() - start).count()) / 1000.0;
+}
+
+int main() {
+    Pixel* src = static_cast<Pixel*>(std::malloc(N * sizeof(Pixel)));
+    Pixel* dst = static_cast<Pixel*>(std::malloc(N * sizeof(Pixel)));
+    for (size_t i = 0; i < N; i++) src[i] = Pixel{1, 2, 3, 4, float(i)};
+    for (size_t i = 0; i < N; i++) dst[i] = Pixel{};   // fault the pages in up front
+
+    const Pixel grey{128, 128, 128, 255, 1.0f};
+    const Pixel zero{};
+
+    std::printf("%zu MiB x %d reps        loop      career\n", (N * sizeof(Pixel)) >> 20, REPS);
+    std::printf("copy                 %8.1f ms %8.1f ms\n",
+                ms([&](int) { loop_copy(src, src + N, dst); g_sink = g_sink + dst[N - 1].depth; }),
+                ms([&](int) { career::uninitialized_copy(src, src + N, dst); g_sink = g_sink + dst[N - 1].depth; }));
+    std::printf("fill (zero)          %8.1f ms %8.1f ms\n",
+                ms([&](int) { loop_fill(dst, dst + N, zero); g_sink = g_sink + dst[N - 1].depth; }),
+                ms([&](int) { career::uninitialized_fill(dst, dst + N, zero); g_sink = g_sink + dst[N - 1].depth; }));
+    std::printf("fill (grey)          %8.1f ms %8.1f ms\n",
+                ms([&](int) { loop_fill(dst, dst + N, grey); g_sink = g_sink + dst[N - 1].depth; }),
+                ms([&](int) { career::uninitialized_fill(dst, dst + N, grey); g_sink = g_sink + dst[N - 1].depth; }));
+    std::printf("value_construct      %8.1f ms %8.1f ms\n",
+                ms([&](int) { loop_value_construct(dst, dst + N); g_sink = g_sink + dst[N - 1].depth; }),
+                ms([&](int) { career::uninitialized_value_construct(dst, dst + N); g_sink = g_sink + dst[N - 1].depth; }));
+
+    std::free(src);
+    std::free(dst);
+}
+
+/*
+g++ 12, -O2, x86-64, Linux:
+64 MiB x 20 reps        loop      career
+copy                    302.1 ms    294.2 ms
+fill (zero)             221.5 ms     87.4 ms
+fill (grey)             231.0 ms     93.0 ms
+value_construct         330.3 ms     87.3 ms
+At -O2 GCC already turns the plain pointer copy loop into memcpy, so copy
+is a tie here; the header no longer depends on that happening (-O1, -Og,
+or a loop the optimizer can't see through). 64 MiB is past the streaming
+threshold, so the fills run on the non-temporal SIMD kernels
+(simd_fill_benchmark.cpp).
+*/
@@ -0,0 +1,94 @@
+// vector_growth_benchmark.cpp
+// NoMoveVsMovable.cpp on career's Vector: what reserve() does with the old elements
+//
+// Pushes 50000 elements that each own a 100-int std::vector, so every
+// reallocation has to carry all of them across:
+//
+//   NoMove      : copy constructor only         -> reserve copies (deep copy)
+//   Movable     : implicit noexcept move        -> reserve moves + destroys
+//   Relocatable : Movable, opted in to career::is_trivially_relocatable
+//                 -> reserve is one memcpy per growth
+//
+// Build: g++ -std=c++17 -O2 vector_growth_benchmark.cpp -o program.exe
+
+#define VECTOR_NO_MAIN
+#include "../../Vector.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace std::chrono;
+
+struct NoMove {
+    NoMove() {
+        xs.resize(100);
+    }
+    NoMove(const NoMove&) = default;
+    NoMove& operator=(const NoMove&) = default;
+    std::vector<int> xs;
+};
+
+struct Movable {
+    Movable() {
+        xs.resize(100);
+    }
+    std::vector<int> xs;
+};
+
+// libstdc++'s std::vector is three pointers into the heap, nothing points
+// back into the object - moving its bytes is a valid move
+struct Relocatable {
+    Relocatable() {
+        xs.resize(100);
+    }
+    std::vector<int> xs;
+};
+
+template<>
+struct career::is_trivially_relocatable<Relocatable> : career::true_type {};
+
+constexpr int N = 50000;
+constexpr int REPS = 10;
+
+volatile size_t g_sink = 0;
+
+template<typename Container>
+static double push_ms() {
+    double best = 1e30;
+    for (int r = 0; r < REPS; r++) {
+        auto start = steady_clock::now();
+        {
+            Container c;
+            for (int i = 0; i < N; i++) {
+                c.push_back(typename Container::value_type{});
+            }
+            g_sink = g_sink + c[N - 1].xs.size();
+        }
+        best = std::min(best, duration<double, std::milli>(steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+int main() {
+    std::printf("%d push_backs, best of %d   std::vector   career Vector\n", N, REPS);
+    std::printf("NoMove                     %8.2f ms     %8.2f ms\n",
+                push_ms<std::vector<NoMove>>(), push_ms<Vector<NoMove>>());
+    std::printf("Movable                    %8.2f ms     %8.2f ms\n",
+                push_ms<std::vector<Movable>>(), push_ms<Vector<Movable>>());
+    std::printf("Relocatable                %8.2f ms     %8.2f ms\n",
+                push_ms<std::vector<Relocatable>>(), push_ms<Vector<Relocatable>>());
+}
+
+/*
+g++ 12, -O2, x86-64, Linux:
+50000 push_backs, best of 10   std::vector   career Vector
+NoMove                        31.33 ms        30.20 ms
+Movable                       14.51 ms        13.73 ms
+Relocatable                   14.26 ms        14.30 ms
+Before this change Vector copied in every case (Movable 31.39 ms,
+Relocatable 29.91 ms): reserve now matches std::vector's move_if_noexcept.
+Relocatable ties Movable here because the loop is dominated by each
+element's own 400-byte allocation; the memcpy path only removes the
+per-element move + destroy during growth, which is a small share of it.
+*/
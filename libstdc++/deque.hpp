@@ -1,22 +1,31 @@
 #include <cstddef> 
 #include <memory> 
 
-namespace career {
+#include "allocator_traits.hpp"
+#include "segmented_iterator.hpp"
+#include "storage_policy.hpp"
+#include "type_traits.hpp"
+#include "uninitialized.hpp"
 
-// =================================
-// POINTER REBIND 
-// =================================
-template<typename Ptr, typename U> 
-using ptr_rebind = typename std::pointer_traits<Ptr>::template rebind<U>; 
+// NOTE: work in progress - Deque doesn't compile yet. The allocator_traits
+//       and block_layout plumbing follows Vector's, but hasn't been built.
+
+namespace career {
 
 // =================================
 // CONFIGURATION CONSTANTS
 // =================================
 
-constexpr int DEQUE_BUFFER_SIZE = 512;
+// Byte budget of one node. The element count per node comes from
+// block_layout, so every Deque<T> gets its own node size at compile time.
+constexpr size_t DEQUE_BUFFER_SIZE = 512;
+
+template<typename T>
+using deque_node_layout = block_layout<T, DEQUE_BUFFER_SIZE>;
 
-inline constexpr size_t calculate_buffer_size(size_t element_size) {
-    return size_t(DEQUE_BUFFER_SIZE) < element_size ? size_t(1) : size_t(DEQUE_BUFFER_SIZE / element_size); 
+template<typename T>
+inline constexpr size_t calculate_buffer_size() noexcept {
+    return deque_node_layout<T>::count;
 }
 
 // =================================
@@ -29,7 +38,7 @@ struct DequeIterator {
     using value_type = T; 
     using pointer = Pointer; 
     using reference = Reference; 
-    using size_type - size_t; 
+    using size_type = size_t; 
     using difference_type = ptrdiff_t; 
 
     using ElementPointer = ptr_rebind<Pointer, T>; 
@@ -41,8 +50,8 @@ struct DequeIterator {
     ElementPointer last; // last element within current buffer 
     MapPointer node; // pointer to the node in the map(this node points to buffer)
 
-    static size_t buffer_size() noexcept {
-        return calculate_buffer_size(sizeof(value_type));
+    static constexpr size_t buffer_size() noexcept {
+        return calculate_buffer_size<value_type>();
     }
 
     // Constructors
@@ -163,11 +172,37 @@ struct DequeIterator {
 //     return it + n;
 // }
 
+// A Deque range is one segment per node: the map pointer walks the
+// segments, an element pointer walks inside one. This lets
+// career::uninitialized_* copy node by node (memmove for trivial T)
+// instead of checking for a node boundary on every ++.
+template<typename T, typename Reference, typename Pointer>
+struct segmented_iterator_traits<DequeIterator<T, Reference, Pointer>> {
+    static constexpr bool is_segmented = true;
+
+    using iterator = DequeIterator<T, Reference, Pointer>;
+    using segment_iterator = typename iterator::MapPointer;
+    using local_iterator = typename iterator::ElementPointer;
+
+    static segment_iterator segment(const iterator& it) noexcept {
+        return it.node;
+    }
+    static local_iterator local(const iterator& it) noexcept {
+        return it.current;
+    }
+    static local_iterator segment_begin(segment_iterator s) noexcept {
+        return *s;
+    }
+    static local_iterator segment_end(segment_iterator s) noexcept {
+        return *s + iterator::buffer_size();
+    }
+};
+
 template<typename T, typename Allocator = std::allocator<T>> 
 class DequeBase {
 protected: 
     using allocator_type = Allocator; 
-    using allocator_traits = std::allocator_traits<Allocator>; 
+    using allocator_traits = career::allocator_traits<Allocator>; 
     using pointer = typename allocator_traits::pointer; 
 
     using MapPointer = ptr_rebind<pointer, pointer> 
@@ -203,25 +238,25 @@ protected:
     }
 
     pointer allocate_node() {
-        return std::allocator_traits<Allocator>::allocate(allocator, calculate_buffer_size(sizeof(T))); 
+        return allocator_traits::allocate(allocator, calculate_buffer_size<T>()); 
     }
 
     void deallocate_node(pointer p) noexcept {
-        std::allocator_traits<Allocator>::deallocate(allocator, p, calculate_buffer_size(sizeof(T)));
+        allocator_traits::deallocate(allocator, p, calculate_buffer_size<T>());
     }
 
     MapPointer allocate_map(size_t n) {
-        std::allocator_traits<Allocator>::template rebind_alloc<pointer> map_alloc(allocator); 
-        return std::allocator_traits<std::allocator_traits<Allocator>::template rebind_alloc<pointer>>::allocate(map_alloc, n);
+        typename allocator_traits::template rebind_alloc<pointer> map_alloc(allocator); 
+        return allocator_traits::template rebind_traits<pointer>::allocate(map_alloc, n);
     }
     
     void deallocate_map(MapPointer p, size_t n) noexcept {
-        std::allocator_traits<Allocator>::template rebind_alloc<pointer> map_alloc(allocator); 
-        std::allocator_traits<std::allocator_traits<Allocator>::template rebind_alloc<pointer>>::deallocate(map_alloc, p, n);
+        typename allocator_traits::template rebind_alloc<pointer> map_alloc(allocator); 
+        allocator_traits::template rebind_traits<pointer>::deallocate(map_alloc, p, n);
     }
 
     void initialize_map(size_t num_elements) {
-        const size_t num_nodes = num_elements / calculate_buffer_size(sizeof(T)) + 1;
+        const size_t num_nodes = num_elements / calculate_buffer_size<T>() + 1;
         data.map_size = std::max(INITIAL_MAP_SIZE, num_nodes + 2); 
         data.map = allocate_map(data.map_size);
 
@@ -240,7 +275,7 @@ protected:
         data.start.set_node(nstart);
         data.finish.set_node(nfinish - 1);
         data.start.current = data.start.first; 
-        data.finish.current = data.finish.first + num_elements % calculate_buffer_size(sizeof(T));
+        data.finish.current = data.finish.first + num_elements % calculate_buffer_size<T>();
     }   
 
     void create_nodes(MapPointer nstart, MapPointer nfinish) {
@@ -266,6 +301,7 @@ template<typename T, typename Allocator = std::allocator<T>>
 class Deque: protected DequeBase<T, Allocator> {
 private: 
     using Base = DequeBase<T, Allocator>; 
+    using allocator_traits = career::allocator_traits<Allocator>; 
 public: 
     // =================
     // Type Definitions 
@@ -276,8 +312,8 @@ public:
     using difference_type = ptrdiff_t; 
     using referene = T&; 
     using const_reference = const T&; 
-    using pointer = typename std::allocator_traits<Allocator>::pointer; 
-    using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+    using pointer = typename allocator_traits::pointer; 
+    using const_pointer = typename allocator_traits::const_pointer;
 
     using iterator = typename Base::iterator;
     using const_iterator = typename Base::const_iterator;
@@ -303,8 +339,8 @@ public:
 
     // Range constructor 
     template<typename InputIterator, 
-             typename = std::enable_if_t<
-                std::is_base_of_v<std::input_iterator_tag,
+             typename = career::enable_if_t<
+                career::is_base_of_v<std::input_iterator_tag,
                     typename std::iterator_traits<InputIterator>::iterator_category>>>
     Deque(InputIterator first, InputIterator last, const Allocator& alloc = Allocator()): Base(alloc) {
         range_initialize(first, last, typename std::iterator_traits<InputIterator>::iterator_category{}); 
@@ -312,15 +348,15 @@ public:
 
     // Copy constructor 
     Deque(const Deque& other)
-        : Base(std::allocator_traits<Allocator>::select_on_container_copy_construction(
-            other.get_allocator_ref(), other.size())) {
-        std::uninitialized_copy(other.begin(), other.end(), this->data.start);
+        : Base(allocator_traits::select_on_container_copy_construction(
+            other.get_allocator_ref()), other.size()) {
+        career::uninitialized_copy(other.begin(), other.end(), this->data.start);
     }
 
     // Copy constructor with allocator 
     Deque(const Deque& other, const Allocator& alloc)
         : Base(alloc, other.size()) {
-        std::uninitialized_copy(other.begin(), other.end(), this->data.start);
+        career::uninitialized_copy(other.begin(), other.end(), this->data.start);
     }
 
     // Move constructor
@@ -343,10 +379,7 @@ public:
         } else {
             // Allocators differ - must move elements 
             this->initialize_map(other.size()); 
-            std::uninitialized_copy(
-                std::make_move_iterator(other.begin()), 
-                std::make_move_iterator(other.end()),
-                this->data.start);
+            career::uninitialized_move(other.begin(), other.end(), this->data.start);
             other.clear();
         }
     }
@@ -366,7 +399,20 @@ public:
 
     // Copy assignment 
     Deque& operator=(const Deque& other) {
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value &&
+                      !allocator_traits::is_always_equal::value) {
+            // Our memory can't outlive our allocator: rebuild with theirs
+            if (this != &other && this->allocator != other.allocator) {
+                Deque tmp(other, other.get_allocator_ref());
+                this->data.swap_data(tmp.data);
+                std::swap(this->allocator, tmp.allocator);
+                return *this;
+            }
+        }
         if (this != &other) {
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                this->allocator = other.allocator;
+            }
             const size_type len = size(); 
             if (len >= other.size()) {
                 erase_at_end(std::copy(other.begin(), other.end(), begin()));
@@ -381,10 +427,14 @@ public:
     
     // Move assignment 
     Deque& operator=(Deque&& other) noexcept(
-        std::allocator_traits<Allocator>::is_always_equal::value) {
-        // Move with propagation handling 
-        constexpr bool propagate = std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value; 
-        move_assign(std::move(other, std::bool_constant<propagate>{}));
+        allocator_traits::propagate_on_container_move_assignment::value ||
+        allocator_traits::is_always_equal::value) {
+        // Chosen at compile time: if the allocator propagates or all
+        // allocators are equal, just steal the map (O(1)); otherwise
+        // move_assign compares allocators at runtime.
+        constexpr bool steal = allocator_traits::propagate_on_container_move_assignment::value ||
+                               allocator_traits::is_always_equal::value; 
+        move_assign(std::move(other), career::bool_constant<steal>{});
         return *this;
     }
 
@@ -400,8 +450,8 @@ public:
     }
 
     template<typename InputIterator, 
-             typename - std::enable_if_t<
-                std::is_base_of_v<std::input_iterator_tag, 
+             typename = career::enable_if_t<
+                career::is_base_of_v<std::input_iterator_tag, 
                     typename std::iterator_traits<InputIterator>::iterator_category>>> 
     void assign(InputIterator first, InputIterator last) {
         assign_aux(first, last, typename std::iterator_traits<InputIterator>::iterator_category{}); 
@@ -472,7 +522,7 @@ public:
 
     [[nodiscard]] size_type max_size() const noexcept {
         const size_type diff_max = std::numeric_limits<difference_type>::max(); 
-        const size_type alloc_max = std::allocator_traits<Allocator>::max_size(this->allocator); 
+        const size_type alloc_max = allocator_traits::max_size(this->allocator); 
         return std::min(diff_max, alloc_max);
     }
 
@@ -542,7 +592,7 @@ public:
 
     void push_front(const T& value) {
         if (this->data.start.current != this->data.start.first) {
-            std::allocator_traits<Allocator>::construct(this->allocator, this->data.start.current - 1, value);
+            allocator_traits::construct(this->allocator, this->data.start.current - 1, value);
         } else {
             push_front_aux(value);
         }
@@ -554,7 +604,7 @@ public:
     template<typename... Args> 
     reference emplace_front(Args&&... args) {
         if (this->data.start.current != this->data.start.first) {
-            std::allocator_traits<Allocator>::construct(this->allocator, this->data.start.current - 1, std::forward<Args>(args)...);
+            allocator_traits::construct(this->allocator, this->data.start.current - 1, std::forward<Args>(args)...);
             --this->data.start.current;
         } else {
             emplace_front_aux(std::forward<Args>(args)...); 
@@ -642,8 +692,8 @@ public:
     }
     
     template<typename InputIterator,
-             typename = std::enable_if_t<
-                 std::is_base_of_v<std::input_iterator_tag,
+             typename = career::enable_if_t<
+                 career::is_base_of_v<std::input_iterator_tag,
                      typename std::iterator_traits<InputIterator>::iterator_category>>>
     iterator insert(const_iterator position, InputIterator first, InputIterator last) {
         difference_type offset = position - cbegin();
@@ -674,9 +724,13 @@ public:
     // ========================================================================
     
     void swap(Deque& other) noexcept(
+        allocator_traits::propagate_on_container_swap::value ||
         allocator_traits::is_always_equal::value) {
         this->data.swap_data(other.data);
-        std::swap(this->allocator, other.allocator);
+        // Without POCS the allocators stay put (and must compare equal)
+        if constexpr (allocator_traits::propagate_on_container_swap::value) {
+            std::swap(this->allocator, other.allocator);
+        }
     }
     
     void clear() noexcept {
@@ -730,8 +784,8 @@ private:
                    std::forward_iterator_tag);
     
     // Move assignment helpers
-    void move_assign(Deque&& other, std::true_type) noexcept;
-    void move_assign(Deque&& other, std::false_type);
+    void move_assign(Deque&& other, career::true_type) noexcept;
+    void move_assign(Deque&& other, career::false_type);
     
     // Push/pop aux functions
     void push_front_aux(const T& value);
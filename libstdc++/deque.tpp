@@ -37,10 +37,10 @@ void Deque<T, Allocator>::fill_initialize(const T& value) {
     MapPointer cur;
     try {
         for (cur = this->data.start.node; cur < this->data.finish.node; ++cur) {
-            std::uninitialized_fill(*cur, *cur + this->data.start.buffer_size(), value);
+            career::uninitialized_fill(*cur, *cur + this->data.start.buffer_size(), value);
         }
         // Handle last (partial) buffer
-        std::uninitialized_fill(this->data.finish.first, this->data.finish.current, value);
+        career::uninitialized_fill(this->data.finish.first, this->data.finish.current, value);
     } catch (...) {
         // Cleanup on exception
         destroy_data(this->data.start, iterator(this->data.finish.first, cur));
@@ -75,11 +75,11 @@ void Deque<T, Allocator>::range_initialize(ForwardIterator first, ForwardIterato
         for (cur_node = this->data.start.node; cur_node < this->data.finish.node; ++cur_node) {
             ForwardIterator mid = first;
             std::advance(mid, this->data.start.buffer_size());
-            std::uninitialized_copy(first, mid, *cur_node);
+            career::uninitialized_copy(first, mid, *cur_node);
             first = mid;
         }
         // Handle last (partial) buffer
-        std::uninitialized_copy(first, last, this->data.finish.first);
+        career::uninitialized_copy(first, last, this->data.finish.first);
     } catch (...) {
         destroy_data(this->data.start, iterator(this->data.finish.first, cur_node));
         throw;
@@ -135,16 +135,16 @@ void Deque<T, Allocator>::assign_aux(ForwardIterator first, ForwardIterator last
 }
 
 template<typename T, typename Allocator>
-void Deque<T, Allocator>::move_assign(Deque&& other, std::true_type) noexcept {
+void Deque<T, Allocator>::move_assign(Deque&& other, career::true_type) noexcept {
     clear();
     this->data.swap_data(other.data);
     this->allocator = std::move(other.allocator);
 }
 
 template<typename T, typename Allocator>
-void Deque<T, Allocator>::move_assign(Deque&& other, std::false_type) {
+void Deque<T, Allocator>::move_assign(Deque&& other, career::false_type) {
     if (this->allocator == other.allocator) {
-        move_assign(std::move(other), std::true_type{});
+        move_assign(std::move(other), career::true_type{});
     } else {
         assign(std::make_move_iterator(other.begin()),
                std::make_move_iterator(other.end()));
@@ -274,7 +274,7 @@ void Deque<T, Allocator>::fill_insert(iterator position, size_type count, const
     if (position.current == this->data.start.current) {
         iterator new_start = reserve_elements_at_front(count);
         try {
-            std::uninitialized_fill(new_start, this->data.start, value);
+            career::uninitialized_fill(new_start, this->data.start, value);
             this->data.start = new_start;
         } catch (...) {
             this->destroy_nodes(new_start.node, this->data.start.node);
@@ -283,7 +283,7 @@ void Deque<T, Allocator>::fill_insert(iterator position, size_type count, const
     } else if (position.current == this->data.finish.current) {
         iterator new_finish = reserve_elements_at_back(count);
         try {
-            std::uninitialized_fill(this->data.finish, new_finish, value);
+            career::uninitialized_fill(this->data.finish, new_finish, value);
             this->data.finish = new_finish;
         } catch (...) {
             this->destroy_nodes(this->data.finish.node + 1, new_finish.node + 1);
@@ -303,14 +303,14 @@ void Deque<T, Allocator>::fill_insert(iterator position, size_type count, const
             try {
                 if (elems_before >= count) {
                     iterator start_n = this->data.start + count;
-                    std::uninitialized_move(this->data.start, start_n, new_start);
+                    career::uninitialized_move(this->data.start, start_n, new_start);
                     this->data.start = new_start;
                     std::move(start_n, position, old_start);
                     std::fill(position - count, position, value);
                 } else {
-                    iterator mid = std::uninitialized_move(this->data.start, position, new_start);
+                    iterator mid = career::uninitialized_move(this->data.start, position, new_start);
                     try {
-                        std::uninitialized_fill(mid, this->data.start, value);
+                        career::uninitialized_fill(mid, this->data.start, value);
                     } catch (...) {
                         destroy_data(new_start, mid);
                         throw;
@@ -332,14 +332,14 @@ void Deque<T, Allocator>::fill_insert(iterator position, size_type count, const
             try {
                 if (elems_after > count) {
                     iterator finish_n = this->data.finish - count;
-                    std::uninitialized_move(finish_n, this->data.finish, this->data.finish);
+                    career::uninitialized_move(finish_n, this->data.finish, this->data.finish);
                     this->data.finish = new_finish;
                     std::move_backward(position, finish_n, old_finish);
                     std::fill(position, position + count, value);
                 } else {
-                    std::uninitialized_fill(this->data.finish, position + count, value);
+                    career::uninitialized_fill(this->data.finish, position + count, value);
                     try {
-                        std::uninitialized_move(position, this->data.finish, position + count);
+                        career::uninitialized_move(position, this->data.finish, position + count);
                     } catch (...) {
                         destroy_data(this->data.finish, position + count);
                         throw;
@@ -374,7 +374,7 @@ void Deque<T, Allocator>::range_insert_aux(iterator position,
     if (position.current == this->data.start.current) {
         iterator new_start = reserve_elements_at_front(count);
         try {
-            std::uninitialized_copy(first, last, new_start);
+            career::uninitialized_copy(first, last, new_start);
             this->data.start = new_start;
         } catch (...) {
             this->destroy_nodes(new_start.node, this->data.start.node);
@@ -383,7 +383,7 @@ void Deque<T, Allocator>::range_insert_aux(iterator position,
     } else if (position.current == this->data.finish.current) {
         iterator new_finish = reserve_elements_at_back(count);
         try {
-            std::uninitialized_copy(first, last, this->data.finish);
+            career::uninitialized_copy(first, last, this->data.finish);
             this->data.finish = new_finish;
         } catch (...) {
             this->destroy_nodes(this->data.finish.node + 1, new_finish.node + 1);
@@ -401,16 +401,16 @@ void Deque<T, Allocator>::range_insert_aux(iterator position,
             try {
                 if (elems_before >= count) {
                     iterator start_n = this->data.start + count;
-                    std::uninitialized_move(this->data.start, start_n, new_start);
+                    career::uninitialized_move(this->data.start, start_n, new_start);
                     this->data.start = new_start;
                     std::move(start_n, position, old_start);
                     std::copy(first, last, position - count);
                 } else {
                     ForwardIterator mid = first;
                     std::advance(mid, elems_before);
-                    iterator new_mid = std::uninitialized_copy(first, mid, new_start);
+                    iterator new_mid = career::uninitialized_copy(first, mid, new_start);
                     try {
-                        std::uninitialized_move(this->data.start, position, new_mid);
+                        career::uninitialized_move(this->data.start, position, new_mid);
                     } catch (...) {
                         destroy_data(new_start, new_mid);
                         throw;
@@ -432,16 +432,16 @@ void Deque<T, Allocator>::range_insert_aux(iterator position,
             try {
                 if (elems_after > count) {
                     iterator finish_n = this->data.finish - count;
-                    std::uninitialized_move(finish_n, this->data.finish, this->data.finish);
+                    career::uninitialized_move(finish_n, this->data.finish, this->data.finish);
                     this->data.finish = new_finish;
                     std::move_backward(position, finish_n, old_finish);
                     std::copy(first, last, position);
                 } else {
                     ForwardIterator mid = first;
                     std::advance(mid, elems_after);
-                    std::uninitialized_copy(mid, last, this->data.finish);
+                    career::uninitialized_copy(mid, last, this->data.finish);
                     try {
-                        std::uninitialized_move(position, this->data.finish, 
+                        career::uninitialized_move(position, this->data.finish, 
                                               this->data.finish + (count - elems_after));
                     } catch (...) {
                         destroy_data(this->data.finish, this->data.finish + (count - elems_after));
@@ -1,12 +1,32 @@
+#pragma once
+
 #include <type_traits> 
 #include <utility> 
 #include <cstddef> 
+#include <functional> 
+#include <memory> 
+#include <memory_resource> 
+#include <atomic> 
+#include <new> 
+#include <typeinfo> 
+
+#include "allocator_traits.hpp"
+#include "storage_policy.hpp"
 
 namespace career {
 
+    // Tag for the opt-in copy-on-write mode (see "shared constructor" below)
+    struct shared_callable_t {
+        explicit shared_callable_t() = default;
+    };
+    inline constexpr shared_callable_t shared_callable{};
+
     template<typename T> 
     class function; 
 
+    template<typename Signature>
+    class FunctionBatch;   // function_batch.hpp: groups functions by _invoker
+
     template<typename R, typename... Args> 
     class function<R(Args...)> {
     private: 
@@ -16,7 +36,11 @@ namespace career {
         union Storage {
             void* _ptr;
             alignas(std::max_align_t) byte _buffer[SBO_SIZE];
-        }
+            struct {
+                R (*_fn)(Args...);            // plain function pointer (trivial mode)
+                const std::type_info* _type;  // trivial mode has no manager to ask
+            } _trivial;
+        };
 
         // ========================================================================
         // OPERATIONS - What the Manager Can Do
@@ -30,7 +54,8 @@ namespace career {
             GET_POINTER,   // Return a pointer to the stored callable 
             CLONE,         // Copy construct the callable 
             MOVE,          // Move construct the callable 
-            DESTROY        // Destruct the callable
+            DESTROY,       // Destruct the callable
+            UNSHARE        // Make sure we own the callable alone (before mutation)
         }; 
 
         using InvokerFunc = R(*)(const Storage&, Args&&...); 
@@ -43,7 +68,11 @@ namespace career {
         
         Storage _storage;                  // Where the callable is stored 
         InvokerFunc _invoker = nullptr;    // How to call it 
-        ManagerFunc _manager = nullptrl    // How to manage its life time 
+        ManagerFunc _manager = nullptr;    // How to manage its life time 
+                                           // (nullptr + _invoker set = trivial mode)
+
+        template<typename Signature>
+        friend class FunctionBatch;
 
         // ========================================================================
         // HELPER: Check if Type Fits in Small Buffer
@@ -58,13 +87,38 @@ namespace career {
         //   - We need to swap function objects with std::swap
         //   - std::swap does a bitwise copy of the union
         //   - If the type isn't trivially copyable, this could corrupt it!
+        //
+        // That is exactly storage_kind::INLINE for a SBO_SIZE budget.
     
         template<typename F> 
         static constexpr bool _is_small() noexcept {
             using Decayed = std::decay_t<F>; 
-            return sizeof(Decayed) <= SBO_SIZE &&
-                   alignof(Decayed) <= alignof(std::max_allign_t) && 
-                   std::is_trivially_copyable_v<Decayed>; 
+            return storage_policy<Decayed, SBO_SIZE, alignof(std::max_align_t)>::is_inline; 
+        }
+
+        // ========================================================================
+        // HELPER: Check if Type Needs No Manager At All
+        // ========================================================================
+        //
+        // Captureless lambdas / empty functors have no state, and a plain
+        // R(*)(Args...) is just 8 bytes. Neither needs CLONE/MOVE/DESTROY:
+        // copying the Storage bytes IS the copy, and destruction is a no-op.
+        // Both leave the second word of the buffer free, so we park the
+        // type_info there instead of asking a manager for it.
+        //
+        // These are stored with _manager == nullptr ("trivial mode"), which
+        // turns copy/move/destroy into plain memcpy / nothing - no indirect
+        // call into a manager at all.
+        //
+        // The callable has to fit the first word: an alignas(16) empty functor
+        // is 16 bytes and would overlap the type_info, so it takes the SBO path.
+
+        template<typename F>
+        static constexpr bool _is_trivial() noexcept {
+            using Decayed = std::decay_t<F>;
+            return (std::is_same_v<Decayed, R(*)(Args...)> ||
+                    (std::is_empty_v<Decayed> && std::is_trivially_copyable_v<Decayed>)) &&
+                   sizeof(Decayed) <= sizeof(void*) && alignof(Decayed) <= alignof(void*);
         }
 
         // ========================================================================
@@ -107,6 +161,60 @@ namespace career {
             }
         }
 
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ INVOKER FOR PLAIN FUNCTION POINTERS (trivial mode)                  │
+        // └─────────────────────────────────────────────────────────────────────┘
+        //
+        // Not a template: every R(*)(Args...) shares this one invoker, and it
+        // makes a single direct call through the stored pointer.
+        // (Empty callables in trivial mode reuse _invoke_small: with no state
+        //  to load, it compiles down to a direct call of F::operator().)
+
+        static R _invoke_fnptr(const Storage& storage, Args&&... args) {
+            return storage._trivial._fn(std::forward<Args>(args)...);
+        }
+
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ ALLOCATOR BOX (callable + the allocator that owns its memory)       │
+        // └─────────────────────────────────────────────────────────────────────┘
+        //
+        // When the user hands us an allocator, the heap block has to remember
+        // it: CLONE must allocate from the same place and DESTROY must give
+        // the memory back to the same place. So instead of `new F`, we
+        // allocate one block holding both the callable and a copy of the
+        // allocator. _ptr points at the box.
+
+        template<typename F, typename Alloc>
+        struct _AllocBox {
+            F _func;
+            Alloc _alloc;
+
+            template<typename G>
+            _AllocBox(G&& g, const Alloc& alloc)
+                : _func(std::forward<G>(g)), _alloc(alloc) {}
+        };
+
+        template<typename F, typename Alloc>
+        static R _invoke_large_alloc(const Storage& storage, Args&&... args) {
+            using Box = _AllocBox<std::decay_t<F>, Alloc>;
+            const Box* box = static_cast<const Box*>(storage._ptr);
+            if constexpr (std::is_void_v<R>) {
+                box->_func(std::forward<Args>(args)...);
+            } else {
+                return box->_func(std::forward<Args>(args)...);
+            }
+        }
+
+        template<typename F>
+        static R _invoke_shared(const Storage& storage, Args&&... args) {
+            const auto* box = static_cast<const _SharedBox<std::decay_t<F>>*>(storage._ptr);
+            if constexpr (std::is_void_v<R>) {
+                box->_func(std::forward<Args>(args)...);
+            } else {
+                return box->_func(std::forward<Args>(args)...);
+            }
+        }
+
         // ========================================================================
         // MANAGER IMPLEMENTATIONS
         // ========================================================================
@@ -169,9 +277,9 @@ namespace career {
             // MOVE: Move construct from src to dest, then destroy src
             // Used by move constructor and move assignment
             // ────────────────────────────────────────────────────────────────
-            case Opeartion::MOVE: {
+            case Operation::MOVE: {
                 Decayed* src_ptr = reinterpret_cast<Decayed*>(src._buffer); 
-                ::new (static_case<void*>(dest._buffer)) Decayed(std::move(*src_ptr));
+                ::new (static_cast<void*>(dest._buffer)) Decayed(std::move(*src_ptr));
                 src_ptr->~Decayed();
                 break; 
             }
@@ -184,6 +292,11 @@ namespace career {
                 obj->~Decayed(); 
                 break;
             }
+            // ────────────────────────────────────────────────────────────────
+            // UNSHARE: Nothing to do - every copy already has its own buffer
+            // ────────────────────────────────────────────────────────────────
+            case Operation::UNSHARE:
+                break;
             }
         }
 
@@ -238,9 +351,177 @@ namespace career {
                 delete static_cast<Decayed*>(src._ptr);
                 src._ptr = nullptr;
                 break;
+
+            case Operation::UNSHARE:
+                break;
+            }
+        }
+
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ MANAGER FOR SHARED STORAGE (copy-on-write, refcounted heap box)      │
+        // └─────────────────────────────────────────────────────────────────────┘
+        //
+        // Copying a large callable means a heap allocation + a deep copy. When
+        // the same handler is fanned out to hundreds of subscribers that is
+        // pure waste, since operator() only ever calls the callable as const.
+        // In shared mode:
+        //   - CLONE just bumps an intrusive refcount (O(1), no allocation)
+        //   - DESTROY drops it, and the last owner deletes the box
+        //   - UNSHARE (done before handing out a mutable pointer) performs
+        //     the real copy, but only if someone else still holds the box
+
+        template<typename F>
+        struct _SharedBox {
+            std::atomic<size_t> _refs;
+            F _func;
+
+            template<typename G>
+            explicit _SharedBox(G&& g) : _refs(1), _func(std::forward<G>(g)) {}
+        };
+
+        template<typename F>
+        static void _release_shared(_SharedBox<F>* box) noexcept {
+            // acq_rel: the last owner must see every other owner's writes
+            if (box->_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete box;
+            }
+        }
+
+        template<typename F>
+        static void _manage_shared(Operation op, Storage& dest, Storage& src,
+                                   void** ret_ptr, const std::type_info** ret_type) {
+            using Decayed = std::decay_t<F>;
+            using Box = _SharedBox<Decayed>;
+
+            switch (op) {
+
+            case Operation::GET_TYPE_INFO:
+                if (ret_type) {
+                    *ret_type = &typeid(Decayed);
+                }
+                break;
+
+            case Operation::GET_POINTER:
+                if (ret_ptr) {
+                    *ret_ptr = &static_cast<Box*>(src._ptr)->_func;
+                }
+                break;
+
+            // ────────────────────────────────────────────────────────────────
+            // CLONE: Share the box - no allocation, no copy of F
+            // ────────────────────────────────────────────────────────────────
+            case Operation::CLONE: {
+                Box* box = static_cast<Box*>(src._ptr);
+                box->_refs.fetch_add(1, std::memory_order_relaxed);
+                dest._ptr = box;
+                break;
+            }
+
+            case Operation::MOVE:
+                dest._ptr = src._ptr;
+                src._ptr = nullptr;
+                break;
+
+            case Operation::DESTROY:
+                _release_shared(static_cast<Box*>(src._ptr));
+                src._ptr = nullptr;
+                break;
+
+            // ────────────────────────────────────────────────────────────────
+            // UNSHARE: The deferred deep copy (only if the box is shared)
+            // ────────────────────────────────────────────────────────────────
+            case Operation::UNSHARE: {
+                Box* box = static_cast<Box*>(src._ptr);
+                if (box->_refs.load(std::memory_order_acquire) != 1) {
+                    Box* copy = new Box(box->_func);
+                    _release_shared(box);
+                    src._ptr = copy;
+                }
+                break;
+            }
+            }
+        }
+
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ MANAGER FOR LARGE STORAGE (user-supplied allocator)                  │
+        // └─────────────────────────────────────────────────────────────────────┘
+        //
+        // Same as _manage_large, but every allocation/deallocation goes
+        // through the allocator stored inside the box. With an arena-backed
+        // allocator (e.g. std::pmr::monotonic_buffer_resource) DESTROY only
+        // runs the destructor - the memory is released when the arena is.
+
+        template<typename F, typename Alloc>
+        static void _manage_large_alloc(Operation op, Storage& dest, Storage& src,
+                                        void** ret_ptr, const std::type_info** ret_type) {
+            using Decayed = std::decay_t<F>;
+            using Box = _AllocBox<Decayed, Alloc>;
+            using BoxAlloc = typename career::allocator_traits<Alloc>::template rebind_alloc<Box>;
+            using BoxTraits = career::allocator_traits<BoxAlloc>;
+
+            switch (op) {
+
+            case Operation::GET_TYPE_INFO:
+                if (ret_type) {
+                    *ret_type = &typeid(Decayed);
+                }
+                break;
+
+            case Operation::GET_POINTER:
+                if (ret_ptr) {
+                    *ret_ptr = &static_cast<Box*>(src._ptr)->_func;
+                }
+                break;
+
+            // ────────────────────────────────────────────────────────────────
+            // CLONE: Allocate the copy from the source's allocator
+            // ────────────────────────────────────────────────────────────────
+            case Operation::CLONE: {
+                const Box* src_box = static_cast<const Box*>(src._ptr);
+                dest._ptr = _create_box<Decayed>(src_box->_alloc, src_box->_func);
+                break;
+            }
+
+            case Operation::MOVE:
+                dest._ptr = src._ptr;
+                src._ptr = nullptr;
+                break;
+
+            // ────────────────────────────────────────────────────────────────
+            // DESTROY: Destruct, then hand memory back to the same allocator
+            // ────────────────────────────────────────────────────────────────
+            case Operation::DESTROY: {
+                Box* box = static_cast<Box*>(src._ptr);
+                BoxAlloc box_alloc(box->_alloc);  // copy out before the box dies
+                box->~Box();
+                BoxTraits::deallocate(box_alloc, box, 1);
+                src._ptr = nullptr;
+                break;
+            }
+
+            case Operation::UNSHARE:
+                break;
             }
         }
 
+        // Allocate + construct a box; gives the memory back if F's constructor throws
+        template<typename Decayed, typename Alloc, typename G>
+        static void* _create_box(const Alloc& alloc, G&& g) {
+            using Box = _AllocBox<Decayed, Alloc>;
+            using BoxAlloc = typename career::allocator_traits<Alloc>::template rebind_alloc<Box>;
+            using BoxTraits = career::allocator_traits<BoxAlloc>;
+
+            BoxAlloc box_alloc(alloc);
+            Box* box = BoxTraits::allocate(box_alloc, 1);
+            try {
+                ::new (static_cast<void*>(box)) Box(std::forward<G>(g), alloc);
+            } catch(...) {
+                BoxTraits::deallocate(box_alloc, box, 1);
+                throw;
+            }
+            return box;
+        }
+
         // ========================================================================
         // CONSTRUCTION HELPER
         // ========================================================================
@@ -268,7 +549,27 @@ namespace career {
             // DECIDE: Small buffer or heap?
             // ────────────────────────────────────────────────────────────────
             
-            if constexpr (_is_small<Decayed>()) {
+            if constexpr (std::is_same_v<Decayed, R(*)(Args...)>) {
+                // ═══════════════════════════════════════════════════════════
+                // TRIVIAL PATH (function pointer): no manager at all
+                // ═══════════════════════════════════════════════════════════
+                _storage._trivial._fn = f;
+                _storage._trivial._type = &typeid(Decayed);
+                _invoker = &_invoke_fnptr;
+                _manager = nullptr;
+
+            } else if constexpr (_is_trivial<Decayed>()) {
+                // ═══════════════════════════════════════════════════════════
+                // TRIVIAL PATH (stateless callable): no manager at all
+                // ═══════════════════════════════════════════════════════════
+                static_assert(sizeof(Decayed) <= sizeof(_storage._trivial._fn),
+                              "Empty callable must not overlap the type_info slot");
+                ::new (static_cast<void*>(&_storage._buffer)) Decayed(std::forward<F>(f));
+                _storage._trivial._type = &typeid(Decayed);
+                _invoker = &_invoke_small<Decayed>;
+                _manager = nullptr;
+
+            } else if constexpr (_is_small<Decayed>()) {
                 // ═══════════════════════════════════════════════════════════
                 // SMALL PATH: Store inline in buffer (zero allocations!)
                 // ═══════════════════════════════════════════════════════════
@@ -294,6 +595,24 @@ namespace career {
             }
         }
 
+        // Allocator-aware version: small callables still go in the buffer
+        // (no allocation to redirect), large ones come from `alloc`.
+        template<typename F, typename Alloc>
+        void _construct_impl(F&& f, const Alloc& alloc) {
+            using Decayed = std::decay_t<F>;
+
+            static_assert(std::is_invocable_r_v<R, Decayed&, Args...>,
+                        "Callable must be invocable with function<R(Args...)> signature");
+
+            if constexpr (_is_small<Decayed>()) {
+                _construct_impl(std::forward<F>(f));
+            } else {
+                _storage._ptr = _create_box<Decayed>(alloc, std::forward<F>(f));
+                _invoker = &_invoke_large_alloc<Decayed, Alloc>;
+                _manager = &_manage_large_alloc<Decayed, Alloc>;
+            }
+        }
+
         // ========================================================================
         // INTERNAL HELPERS
         // ========================================================================
@@ -304,12 +623,13 @@ namespace career {
         void _reset() noexcept {
             if (_manager) {
                 // Ask manager to destroy the stored callable
+                // (trivial mode has no manager: nothing to destroy)
                 _manager(Operation::DESTROY, _storage, _storage, nullptr, nullptr);
-                
-                // Clear our state
-                _invoker = nullptr;
-                _manager = nullptr;
             }
+
+            // Clear our state
+            _invoker = nullptr;
+            _manager = nullptr;
         }
 
         // ┌─────────────────────────────────────────────────────────────────────┐
@@ -371,6 +691,54 @@ namespace career {
             _construct_impl(std::forward<F>(f));
         }
 
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ Allocator-extended constructor                                        │
+        // │                                                                        │
+        // │ Large callables are allocated through `alloc` (and freed through     │
+        // │ it). Small callables ignore it - they never touch the heap.           │
+        // │                                                                        │
+        // │   std::pmr::monotonic_buffer_resource arena(buf, sizeof(buf));        │
+        // │   function<void()> cb(std::allocator_arg, &arena, big_lambda);        │
+        // └─────────────────────────────────────────────────────────────────────┘
+        template<typename Alloc, typename F,
+                typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, function> &&
+                                            !std::is_convertible_v<const Alloc&, std::pmr::memory_resource*>>>
+        function(std::allocator_arg_t, const Alloc& alloc, F&& f) {
+            _construct_impl(std::forward<F>(f), alloc);
+        }
+
+        // Memory-resource shorthand: wraps the resource in a polymorphic_allocator
+        template<typename F,
+                typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, function>>>
+        function(std::allocator_arg_t, std::pmr::memory_resource* resource, F&& f)
+            : function(std::allocator_arg, std::pmr::polymorphic_allocator<byte>(resource),
+                       std::forward<F>(f)) {}
+
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ Shared constructor: opt-in copy-on-write for large callables          │
+        // │                                                                        │
+        // │   function<void(Event&)> h(career::shared_callable, big_handler);     │
+        // │   for (auto& s : subscribers) s.handler = h;  // refcount++ only      │
+        // │                                                                        │
+        // │ Small callables are unaffected (copying the buffer is already O(1)). │
+        // └─────────────────────────────────────────────────────────────────────┘
+        template<typename F,
+                typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, function>>>
+        function(shared_callable_t, F&& f) {
+            using Decayed = std::decay_t<F>;
+
+            static_assert(std::is_invocable_r_v<R, Decayed&, Args...>,
+                        "Callable must be invocable with function<R(Args...)> signature");
+
+            if constexpr (_is_small<Decayed>()) {
+                _construct_impl(std::forward<F>(f));
+            } else {
+                _storage._ptr = new _SharedBox<Decayed>(std::forward<F>(f));
+                _invoker = &_invoke_shared<Decayed>;
+                _manager = &_manage_shared<Decayed>;
+            }
+        }
+
         // ┌─────────────────────────────────────────────────────────────────────┐
         // │ Copy constructor: Clone the stored callable                          │
         // └─────────────────────────────────────────────────────────────────────┘
@@ -386,8 +754,12 @@ namespace career {
             
             // Use manager to clone the stored callable
             // Manager knows the type and how to copy it!
-            _manager(Operation::CLONE, _storage, 
-                    const_cast<Storage&>(other._storage), nullptr, nullptr);
+            if (_manager) {
+                _manager(Operation::CLONE, _storage, 
+                        const_cast<Storage&>(other._storage), nullptr, nullptr);
+            } else {
+                _storage = other._storage;  // trivial mode: the bytes are the copy
+            }
         }
 
         // ┌─────────────────────────────────────────────────────────────────────┐
@@ -406,7 +778,12 @@ namespace career {
             // Use manager to move the stored callable
             // For small: moves bytes and destructs source
             // For large: transfers pointer
-            _manager(Operation::MOVE, _storage, other._storage, nullptr, nullptr);
+            // For trivial: just the bytes, no manager
+            if (_manager) {
+                _manager(Operation::MOVE, _storage, other._storage, nullptr, nullptr);
+            } else {
+                _storage = other._storage;
+            }
             
             // Clear the moved-from function
             other._clear();
@@ -459,7 +836,11 @@ namespace career {
             // Transfer from other
             _invoker = other._invoker;
             _manager = other._manager;
-            _manager(Operation::MOVE, _storage, other._storage, nullptr, nullptr);
+            if (_manager) {
+                _manager(Operation::MOVE, _storage, other._storage, nullptr, nullptr);
+            } else {
+                _storage = other._storage;
+            }
             other._clear();
             
             return *this;
@@ -484,6 +865,15 @@ namespace career {
             _reset();
             return *this;
         }
+
+        // ┌─────────────────────────────────────────────────────────────────────┐
+        // │ assign: Replace stored callable, allocating through `alloc`           │
+        // └─────────────────────────────────────────────────────────────────────┘
+        template<typename F, typename Alloc>
+        void assign(F&& f, const Alloc& alloc) {
+            function temp(std::allocator_arg, alloc, std::forward<F>(f));
+            swap(temp);
+        }
         
         // ========================================================================
         // SWAP
@@ -524,7 +914,7 @@ namespace career {
         
         R operator()(Args... args) const {
             if (!_invoker) {
-                throw bad_function_call();
+                throw std::bad_function_call();
             }
             
             // Delegate to the invoker
@@ -547,9 +937,12 @@ namespace career {
         // │ Get type_info of stored callable                                     │
         // └─────────────────────────────────────────────────────────────────────┘
         const std::type_info& target_type() const noexcept {
-            if (!_manager) {
+            if (!_invoker) {
                 return typeid(void);  // Empty function
             }
+            if (!_manager) {
+                return *_storage._trivial._type;  // Trivial mode
+            }
             
             // Ask manager for type info
             const std::type_info* ti = nullptr;
@@ -568,12 +961,22 @@ namespace career {
         // │   function<int(int)> f = lambda;                                     │
         // │   auto* ptr = f.target<decltype(lambda)>();  // Get pointer to lambda│
         // └─────────────────────────────────────────────────────────────────────┘
+        //
+        // NOTE: not noexcept - a mutable pointer into a shared (copy-on-write)
+        // callable first triggers the deferred copy, which may allocate.
         template<typename T>
-        T* target() noexcept {
-            if (!_manager || target_type() != typeid(T)) {
+        T* target() {
+            if (!_invoker || target_type() != typeid(T)) {
                 return nullptr;  // Type mismatch or empty
             }
+            if (!_manager) {
+                // Trivial mode: callable (or function pointer) sits at the buffer start
+                return reinterpret_cast<T*>(_storage._buffer);
+            }
             
+            // Caller may mutate through the pointer: stop sharing first
+            _manager(Operation::UNSHARE, _storage, _storage, nullptr, nullptr);
+
             // Ask manager for pointer to callable
             void* p = nullptr;
             _manager(Operation::GET_POINTER, _storage, _storage, &p, nullptr);
@@ -582,9 +985,12 @@ namespace career {
         
         template<typename T>
         const T* target() const noexcept {
-            if (!_manager || target_type() != typeid(T)) {
+            if (!_invoker || target_type() != typeid(T)) {
                 return nullptr;
             }
+            if (!_manager) {
+                return reinterpret_cast<const T*>(_storage._buffer);
+            }
             
             void* p = nullptr;
             _manager(Operation::GET_POINTER, 
@@ -656,4 +1062,23 @@ namespace career {
 //    Prevents template constructor from hijacking copy/move constructors.
 //    Without it, template would match better and cause infinite recursion!
 //
+// 9. ALLOCATOR-AWARE HEAP PATH
+//    ══════════════════════════
+//    function(std::allocator_arg, alloc, f) stores the allocator next to the
+//    callable in one heap block, so the type-erased manager can CLONE and
+//    DESTROY through it later. Pass a pmr arena and a burst of large
+//    callbacks costs a few pointer bumps instead of malloc/free pairs.
+//
+// 10. COPY-ON-WRITE SHARING
+//     ═════════════════════
+//     function(career::shared_callable, f) keeps a large callable in a
+//     refcounted box. Copies share it; the deep copy is deferred to the
+//     first mutable target<T>() on a box that is still shared.
+//
+// 11. TRIVIAL MODE
+//     ════════════
+//     Captureless lambdas and plain R(*)(Args...) are stored with no manager
+//     at all (_manager == nullptr, type_info parked in the buffer). Copy and
+//     move are a 16-byte memcpy, destruction is nothing.
+//
 // ============================================================================
\ No newline at end of file
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "function.cpp"
+
+namespace career {
+
+// ============================================================================
+// FunctionBatch - call many callbacks with one indirect call per TYPE
+// ============================================================================
+//
+// Problem: a std::vector<career::function<void(Event&)>> pays one indirect
+//          call (through _invoker) per element. With many different lambda
+//          types mixed together the branch predictor keeps missing and the
+//          i-cache keeps jumping between invokers.
+//
+// Solution: group callables by their concrete type, struct-of-arrays style.
+//           Each group is a contiguous std::vector<F>, plus ONE function
+//           pointer that loops over the whole group. Inside that loop the
+//           type is known, so every call is direct (and usually inlined).
+//
+//   groups:  [ vector<LambdaA> | _invoke_all<LambdaA> ]   <- 1 indirect call
+//            [ vector<LambdaB> | _invoke_all<LambdaB> ]   <- 1 indirect call
+//
+// Already-erased callables - the std::vector<career::function<void(Event&)>>
+// a dispatcher holds today - can be moved in too. Their type is gone, so
+// they are grouped by their stored _invoker instead:
+//
+//   [ vector<function> | _invoke_erased ]  <- 1 indirect call into the loop,
+//                                             then the SAME invoker per element
+//
+// Each element still costs an indirect call, but every call in the group
+// hits one target, so it is predicted and the i-cache stays put. Adding the
+// raw callables is better still: those calls are direct and inlinable.
+//
+// NOTE: callables run group by group, so the call order is NOT the insertion
+//       order across different types (it is within one type).
+
+template<typename Signature>
+class FunctionBatch;
+
+template<typename... Args>
+class FunctionBatch<void(Args...)> {
+private:
+    // Same idea as career::function's manager, but for a whole group
+    enum class Operation {
+        CLONE,   // Copy the group's vector
+        DESTROY  // Delete the group's vector
+    };
+
+    // Arguments are passed as lvalues: the same args go to every callable,
+    // so we must never move out of them.
+    using InvokeAllFunc = void(*)(void* items, Args&... args);
+    using ManagerFunc = void*(*)(Operation op, void* items);
+
+    struct Group {
+        const void* key;           // &_type_key<F>: identifies the group
+        void* items;               // really a std::vector<F>* for this group's F
+        InvokeAllFunc invoke_all;  // loops over items
+        ManagerFunc manager;       // knows F, so it can copy/delete items
+    };
+
+    // One distinct address per type. (Comparing &_invoke_all<F> instead would
+    // break under identical-code folding, which may merge two invokers.)
+    template<typename F>
+    static inline const char _type_key = 0;
+
+    std::vector<Group> _groups;
+    size_t _size = 0;
+
+    // ┌─────────────────────────────────────────────────────────────────────┐
+    // │ Per-type kernels                                                     │
+    // └─────────────────────────────────────────────────────────────────────┘
+
+    template<typename F>
+    static void _invoke_all(void* items, Args&... args) {
+        for (F& f : *static_cast<std::vector<F>*>(items)) {
+            f(args...);  // direct call - F is known here
+        }
+    }
+
+    // A group of career::functions that all share one invoker. Args are
+    // re-passed as Args (copies for by-value params) so no call can move
+    // out of the caller's arguments.
+    using Erased = function<void(Args...)>;
+
+    static void _invoke_erased(void* items, Args&... args) {
+        auto& vec = *static_cast<std::vector<Erased>*>(items);
+        if (vec.empty()) {
+            return;
+        }
+        const auto invoker = vec.front()._invoker;
+        for (Erased& f : vec) {
+            invoker(f._storage, static_cast<Args>(args)...);
+        }
+    }
+
+    template<typename F>
+    static void* _manage(Operation op, void* items) {
+        auto* vec = static_cast<std::vector<F>*>(items);
+        switch (op) {
+        case Operation::CLONE:
+            return new std::vector<F>(*vec);
+        case Operation::DESTROY:
+            delete vec;
+            return nullptr;
+        }
+        return nullptr;
+    }
+
+    // Linear scan is fine: there are only as many groups as distinct types
+    // (or, for erased functions, distinct invokers)
+    template<typename F>
+    std::vector<F>& _group_for(const void* key, InvokeAllFunc invoke_all) {
+        for (Group& g : _groups) {
+            if (g.key == key) {
+                return *static_cast<std::vector<F>*>(g.items);
+            }
+        }
+
+        auto* items = new std::vector<F>();
+        try {
+            _groups.push_back(Group{key, items, invoke_all, &_manage<F>});
+        } catch(...) {
+            delete items;
+            throw;
+        }
+        return *items;
+    }
+
+    void _destroy_groups() noexcept {
+        for (Group& g : _groups) {
+            g.manager(Operation::DESTROY, g.items);
+        }
+        _groups.clear();
+        _size = 0;
+    }
+
+public:
+    FunctionBatch() = default;
+
+    FunctionBatch(const FunctionBatch& other) : _size(other._size) {
+        _groups.reserve(other._groups.size());
+        try {
+            for (const Group& g : other._groups) {
+                void* items = g.manager(Operation::CLONE, g.items);
+                _groups.push_back(Group{g.key, items, g.invoke_all, g.manager});
+            }
+        } catch(...) {
+            _destroy_groups();
+            throw;
+        }
+    }
+
+    FunctionBatch(FunctionBatch&& other) noexcept
+        : _groups(std::move(other._groups)), _size(other._size) {
+        other._groups.clear();
+        other._size = 0;
+    }
+
+    FunctionBatch& operator=(const FunctionBatch& other) {
+        FunctionBatch temp(other);
+        swap(temp);
+        return *this;
+    }
+
+    FunctionBatch& operator=(FunctionBatch&& other) noexcept {
+        FunctionBatch temp(std::move(other));
+        swap(temp);
+        return *this;
+    }
+
+    ~FunctionBatch() {
+        _destroy_groups();
+    }
+
+    // ========================================================================
+    // MODIFIERS
+    // ========================================================================
+
+    template<typename F,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, FunctionBatch> &&
+                                         !std::is_same_v<std::decay_t<F>, Erased>>>
+    void add(F&& f) {
+        using Decayed = std::decay_t<F>;
+        static_assert(std::is_invocable_v<Decayed&, Args&...>,
+                      "Callable must be invocable with FunctionBatch<void(Args...)> signature");
+
+        _group_for<Decayed>(&_type_key<Decayed>, &_invoke_all<Decayed>).push_back(std::forward<F>(f));
+        ++_size;
+    }
+
+    // An already-erased function joins the group of its invoker. Two
+    // invokers folded into one by the linker share a group - harmless, the
+    // code is identical. Throws bad_function_call if f is empty.
+    void add(Erased&& f) {
+        if (!f) {
+            throw std::bad_function_call();
+        }
+        const void* key = reinterpret_cast<const void*>(f._invoker);
+        _group_for<Erased>(key, &_invoke_erased).push_back(std::move(f));
+        ++_size;
+    }
+
+    void add(const Erased& f) {
+        add(Erased(f));
+    }
+
+    // Move a dispatcher's whole callback list in
+    void add_all(std::vector<Erased>&& fs) {
+        for (Erased& f : fs) {
+            add(std::move(f));
+        }
+        fs.clear();
+    }
+
+    void clear() noexcept {
+        _destroy_groups();
+    }
+
+    void swap(FunctionBatch& other) noexcept {
+        _groups.swap(other._groups);
+        std::swap(_size, other._size);
+    }
+
+    // ========================================================================
+    // INVOCATION - one indirect call per group
+    // ========================================================================
+
+    void invoke_all(Args... args) const {
+        for (const Group& g : _groups) {
+            g.invoke_all(g.items, args...);
+        }
+    }
+
+    void operator()(Args... args) const {
+        invoke_all(args...);
+    }
+
+    // ========================================================================
+    // OBSERVERS
+    // ========================================================================
+
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+    size_t group_count() const noexcept { return _groups.size(); }
+};
+
+template<typename... Args>
+void swap(FunctionBatch<void(Args...)>& lhs, FunctionBatch<void(Args...)>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace career
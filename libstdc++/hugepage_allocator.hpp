@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include "allocator_traits.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace career {
+
+// ============================================================================
+// HUGE PAGES - fewer, bigger pages => fewer TLB misses
+// ============================================================================
+//
+// The TLB caches virtual->physical translations, ~1.5k entries on a
+// modern core. With 4 KiB pages that covers ~6 MiB; random access over a
+// multi-GiB container misses the TLB on nearly every load and pays a page
+// walk. A 2 MiB page covers 512x more memory per entry.
+//
+// Large requests (>= HUGE_PAGE_SIZE) get their own mapping, tried in order:
+//
+//   1. mmap(MAP_HUGETLB | 2 MiB)   explicit huge pages; only works when
+//                                  the admin reserved 2 MiB ones
+//                                  (vm.nr_hugepages, or the 2048kB pool)
+//   2. mmap + madvise(MADV_HUGEPAGE) transparent huge pages: the kernel
+//                                  backs 2 MiB-aligned ranges with huge
+//                                  pages when it can ("madvise" THP mode)
+//   3. whatever 2. gave us         if THP is off, plain 4 KiB pages
+//
+// Mappings are always a whole number of huge pages (and, for THP, 2 MiB
+// aligned), so deallocate can munmap the same length whichever path won.
+// Small requests go through career::allocator - a huge page per Deque node
+// would waste most of it.
+
+namespace detail {
+
+struct huge_pages {
+    static constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;   // x86-64 / arm64 default
+
+    static constexpr size_t round_up(size_t bytes) noexcept {
+        return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    }
+
+    static void* map(size_t bytes) {
+#if defined(__linux__)
+        const size_t len = round_up(bytes);
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+        // Ask for 2 MiB pages by name: plain MAP_HUGETLB takes the system's
+        // default hugetlb size, which may be 1 GiB - then len isn't a whole
+        // number of pages and unmap(p, round_up(bytes)) fails and leaks.
+        // glibc's <sys/mman.h> has MAP_HUGE_SHIFT but not MAP_HUGE_2MB.
+        constexpr int huge_2mb = 21 << MAP_HUGE_SHIFT;   // log2(2 MiB) = 21
+        void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | huge_2mb, -1, 0);
+        if (p != MAP_FAILED) {
+            return p;
+        }
+#endif
+
+        // Over-map by one huge page so we can trim to a 2 MiB boundary:
+        // THP only uses huge pages for fully aligned 2 MiB ranges
+        const size_t span = len + HUGE_PAGE_SIZE;
+        void* raw = ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        const uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t aligned = (start + HUGE_PAGE_SIZE - 1) & ~uintptr_t(HUGE_PAGE_SIZE - 1);
+        const size_t head = aligned - start;
+        if (head) {
+            ::munmap(raw, head);
+        }
+        if (span - head - len) {
+            ::munmap(reinterpret_cast<void*>(aligned + len), span - head - len);
+        }
+
+        void* region = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+        ::madvise(region, len, MADV_HUGEPAGE);   // best effort: ignored if THP is off
+#endif
+        return region;
+#else
+        return ::operator new(bytes, std::align_val_t(HUGE_PAGE_SIZE));
+#endif
+    }
+
+    static void unmap(void* p, size_t bytes) noexcept {
+#if defined(__linux__)
+        ::munmap(p, round_up(bytes));
+#else
+        ::operator delete(p, bytes, std::align_val_t(HUGE_PAGE_SIZE));
+#endif
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// hugepage_allocator<T>
+// ============================================================================
+//
+// Stateless - every instance can free every other's memory, so it is
+// is_always_equal and containers move/swap buffers in O(1).
+//
+//   std::vector<double, hugepage_allocator<double>> prices;
+//
+// Only buffers of HUGE_PAGE_SIZE or more are huge-page backed: a vector's
+// storage past 2 MiB. Small blocks use career::allocator - that would
+// include Deque's 512 B nodes, though Deque (not compiling yet) has never
+// been run on it.
+
+template<typename T>
+class hugepage_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    static constexpr size_t HUGE_PAGE_SIZE = detail::huge_pages::HUGE_PAGE_SIZE;
+
+    template<typename U>
+    struct rebind {
+        using other = hugepage_allocator<U>;
+    };
+
+    hugepage_allocator() noexcept = default;
+
+    template<typename U>
+    hugepage_allocator(const hugepage_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+        if (uses_huge_pages(n)) {
+            return static_cast<T*>(detail::huge_pages::map(n * sizeof(T)));
+        }
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (uses_huge_pages(n)) {
+            detail::huge_pages::unmap(p, n * sizeof(T));
+        } else {
+            allocator<T>().deallocate(p, n);
+        }
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return allocator<T>().max_size();
+    }
+
+private:
+    static constexpr bool uses_huge_pages(size_type n) noexcept {
+        return n * sizeof(T) >= HUGE_PAGE_SIZE;
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const hugepage_allocator<T>&, const hugepage_allocator<U>&) noexcept {
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const hugepage_allocator<T>&, const hugepage_allocator<U>&) noexcept {
+    return false;
+}
+
+} // namespace career
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "allocator_traits.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Build with -DCAREER_HAVE_LIBNUMA -lnuma to bind to an explicit node.
+// Without it the allocator relies on first-touch placement only.
+#if defined(CAREER_HAVE_LIBNUMA)
+#include <numa.h>
+#include <sched.h>
+#endif
+
+namespace career {
+
+// ============================================================================
+// NUMA PLACEMENT - where do the pages of a buffer physically live?
+// ============================================================================
+//
+//   socket 0 (node 0)            socket 1 (node 1)
+//   [cores] <-> [local DRAM]  <==interconnect==>  [local DRAM] <-> [cores]
+//
+// A core reading DRAM on the OTHER node pays the interconnect hop on every
+// cache miss. Linux places a page on the node of the thread that first
+// WRITES it ("first touch"), not the thread that called malloc. So:
+//
+//   1. Serve big requests from their own page-aligned mmap chunk - pages
+//      that no other allocation shares, so placement is ours to decide.
+//   2. Place them:
+//        libnuma  : mbind the chunk to the wanted node (numa_tonode_memory)
+//        fallback : first touch - the allocating thread writes one byte per
+//                   page right away, pinning the chunk to ITS node
+//
+// Requests smaller than a page can't get pages of their own, so they go
+// through career::allocator (the caller's writes still first-touch them).
+//
+// NOTE: without libnuma an explicit node is only a hint - first touch puts
+//       memory on the caller's node. Allocate from a thread pinned to the
+//       target node, or build with libnuma.
+
+namespace detail {
+
+struct numa_pages {
+    static size_t page_size() noexcept {
+#if defined(__linux__)
+        static const size_t size = size_t(::sysconf(_SC_PAGESIZE));
+        return size;
+#else
+        return 4096;
+#endif
+    }
+
+    static size_t round_up(size_t bytes) noexcept {
+        const size_t page = page_size();
+        return (bytes + page - 1) / page * page;
+    }
+
+    // Node of the calling thread's CPU (0 if unknown)
+    static int current_node() noexcept {
+#if defined(CAREER_HAVE_LIBNUMA)
+        if (::numa_available() >= 0) {
+            const int cpu = ::sched_getcpu();
+            const int node = cpu >= 0 ? ::numa_node_of_cpu(cpu) : -1;
+            return node >= 0 ? node : 0;
+        }
+#endif
+        return 0;
+    }
+
+    // node < 0: caller's node
+    static void* map(size_t bytes, int node) {
+#if defined(__linux__)
+        const size_t len = round_up(bytes);
+        void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#if defined(CAREER_HAVE_LIBNUMA)
+        if (::numa_available() >= 0) {
+            ::numa_tonode_memory(p, len, node < 0 ? current_node() : node);
+        }
+#else
+        (void)node;
+#endif
+        // First touch: fault every page in from THIS thread (under mbind the
+        // pages go to the bound node regardless of who touches them)
+        volatile unsigned char* bytes_ptr = static_cast<unsigned char*>(p);
+        for (size_t off = 0; off < len; off += page_size()) {
+            bytes_ptr[off] = 0;
+        }
+        return p;
+#else
+        (void)node;
+        return ::operator new(bytes);
+#endif
+    }
+
+    static void unmap(void* p, size_t bytes) noexcept {
+#if defined(__linux__)
+        ::munmap(p, round_up(bytes));
+#else
+        ::operator delete(p, bytes);
+#endif
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// numa_allocator<T>
+// ============================================================================
+//
+//   numa_allocator<T>()   - memory on the node of whichever thread allocates
+//   numa_allocator<T>(1)  - memory bound to node 1
+//
+//   std::vector<Order, numa_allocator<Order>> book{numa_allocator<Order>(node)};
+//
+// The node is allocator state: allocators for different nodes compare
+// unequal, and the node travels with the container on move-assign / swap
+// (POCMA, POCS) so a container's storage keeps its placement. Copy-assign
+// keeps the destination's node - the destination's owner chose it.
+
+template<typename T>
+class numa_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    static constexpr int CALLER_NODE = -1;
+
+    template<typename U>
+    struct rebind {
+        using other = numa_allocator<U>;
+    };
+
+    explicit numa_allocator(int node = CALLER_NODE) noexcept : _node(node) {}
+
+    template<typename U>
+    numa_allocator(const numa_allocator<U>& other) noexcept : _node(other.node()) {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+        if (uses_pages(n)) {
+            return static_cast<T*>(detail::numa_pages::map(n * sizeof(T), _node));
+        }
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (uses_pages(n)) {
+            detail::numa_pages::unmap(p, n * sizeof(T));
+        } else {
+            allocator<T>().deallocate(p, n);
+        }
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return allocator<T>().max_size();
+    }
+
+    int node() const noexcept {
+        return _node;
+    }
+
+private:
+    int _node;
+
+    // mmap'd chunks are page aligned, which covers any sane alignof(T)
+    static bool uses_pages(size_type n) noexcept {
+        return n * sizeof(T) >= detail::numa_pages::page_size();
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const numa_allocator<T>& a, const numa_allocator<U>& b) noexcept {
+    return a.node() == b.node();
+}
+
+template<typename T, typename U>
+bool operator!=(const numa_allocator<T>& a, const numa_allocator<U>& b) noexcept {
+    return !(a == b);
+}
+
+} // namespace career
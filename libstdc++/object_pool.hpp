@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "allocator_traits.hpp"
+
+namespace career {
+
+// ============================================================================
+// ObjectPool<T> - fixed-size slots for one type
+// ============================================================================
+//
+// Memory comes in cache-line aligned SLABS of many slots. A free slot
+// stores the free-list link inside itself (intrusive), so the pool needs no
+// side table:
+//
+//   slab (alignas 64): [next slab][slot][slot][slot] ... [slot]
+//
+//   _free -> [slot] -> [slot] -> [slot] -> null     (free slots only)
+//
+// acquire(args...) = pop a slot + placement-new T            O(1)
+// release(p)       = ~T() + push the slot                     O(1)
+// empty free list  = one new slab, all of its slots pushed
+//
+// Slabs are returned only when the pool is destroyed. The pool does NOT
+// destroy objects still acquired at that point - release them first.
+//
+// Thread safety is a template switch: ObjectPool<T, true> guards the free
+// list with a mutex; the default pays nothing for it.
+
+namespace detail {
+
+struct null_mutex {
+    void lock() noexcept {}
+    void unlock() noexcept {}
+};
+
+} // namespace detail
+
+template<typename T, bool ThreadSafe = false>
+class ObjectPool {
+public:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t SLAB_BYTES = 16 * 1024;
+
+    ObjectPool() noexcept = default;
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    ~ObjectPool() {
+        while (_slabs) {
+            Slab* next = _slabs->next;
+            allocator<Slab>().deallocate(_slabs, 1);
+            _slabs = next;
+        }
+    }
+
+    // Raw slot for one T (uninitialized)
+    [[nodiscard]] void* allocate() {
+        std::lock_guard<Mutex> lock(_mutex);
+        if (!_free) {
+            add_slab();
+        }
+        Slot* s = _free;
+        _free = s->next;
+        return s;
+    }
+
+    void deallocate(void* p) noexcept {
+        Slot* s = static_cast<Slot*>(p);
+        std::lock_guard<Mutex> lock(_mutex);
+        s->next = _free;
+        _free = s;
+    }
+
+    template<typename... Args>
+    [[nodiscard]] T* acquire(Args&&... args) {
+        void* p = allocate();
+        try {
+            return ::new (p) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(p);
+            throw;
+        }
+    }
+
+    void release(T* p) noexcept {
+        p->~T();
+        deallocate(p);
+    }
+
+private:
+    using Mutex = std::conditional_t<ThreadSafe, std::mutex, detail::null_mutex>;
+
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static constexpr size_t SLOTS_PER_SLAB =
+        SLAB_BYTES / sizeof(Slot) > 8 ? SLAB_BYTES / sizeof(Slot) : 8;
+
+    struct alignas(CACHE_LINE) Slab {
+        Slab* next;
+        Slot slots[SLOTS_PER_SLAB];
+    };
+
+    Slot* _free = nullptr;
+    Slab* _slabs = nullptr;
+    Mutex _mutex;
+
+    void add_slab() {
+        Slab* slab = allocator<Slab>().allocate(1);   // over-aligned path if needed
+        slab->next = _slabs;
+        _slabs = slab;
+        for (size_t i = SLOTS_PER_SLAB; i-- > 0;) {
+            slab->slots[i].next = _free;
+            _free = &slab->slots[i];
+        }
+    }
+};
+
+// ============================================================================
+// object_pool_allocator<T> - ObjectPool behind the allocator interface
+// ============================================================================
+//
+// Every T gets ONE process-wide ObjectPool<T, true>, so the allocator is
+// stateless (all instances equal) and rebinding just picks the pool for the
+// rebound type - which is what node containers do:
+//
+//   std::list<int, object_pool_allocator<int>>
+//     -> rebinds to object_pool_allocator<_List_node<int>>
+//     -> one slot per list node from ObjectPool<_List_node<int>, true>
+//
+// Only single-object requests use the pool; arrays (a Deque map, a vector
+// buffer) fall back to career::allocator<T>.
+
+template<typename T>
+class object_pool_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = object_pool_allocator<U>;
+    };
+
+    object_pool_allocator() noexcept = default;
+
+    template<typename U>
+    object_pool_allocator(const object_pool_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n == 1) {
+            return static_cast<T*>(pool().allocate());
+        }
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (n == 1) {
+            pool().deallocate(p);
+        } else {
+            allocator<T>().deallocate(p, n);
+        }
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return allocator<T>().max_size();
+    }
+
+    // Never destroyed: a container with static storage duration may still
+    // hand nodes back after a function-local static would be gone
+    static ObjectPool<T, true>& pool() {
+        static ObjectPool<T, true>* shared = new ObjectPool<T, true>();
+        return *shared;
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const object_pool_allocator<T>&, const object_pool_allocator<U>&) noexcept {
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const object_pool_allocator<T>&, const object_pool_allocator<U>&) noexcept {
+    return false;
+}
+
+} // namespace career
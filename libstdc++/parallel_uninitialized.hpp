@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include "uninitialized.hpp"
+
+namespace career {
+
+// ============================================================================
+// EXECUTION POLICIES
+// ============================================================================
+//
+//   career::uninitialized_copy(career::execution::par, first, last, d_first);
+//   career::uninitialized_fill(career::execution::par(4), first, last, v);
+//
+// seq runs the ordinary algorithm. par splits the range over worker threads
+// (par(n) caps them at n, plain par uses hardware_concurrency). These are
+// career's own tags rather than std::execution, which libstdc++ only
+// implements on top of TBB.
+
+namespace execution {
+
+struct sequenced_policy {};
+
+struct parallel_policy {
+    unsigned threads = 0;   // 0 = std::thread::hardware_concurrency()
+
+    constexpr parallel_policy operator()(unsigned n) const noexcept {
+        return parallel_policy{n};
+    }
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+} // namespace execution
+
+template<typename T> struct is_execution_policy : false_type {};
+template<> struct is_execution_policy<execution::sequenced_policy> : true_type {};
+template<> struct is_execution_policy<execution::parallel_policy> : true_type {};
+
+template<typename T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<remove_cv_t<remove_reference_t<T>>>::value;
+
+// ============================================================================
+// PARALLEL CHUNKING
+// ============================================================================
+//
+// One thread writes at most ~10 GB/s; a socket's memory controllers can take
+// several times that. So a big range is cut into equal chunks, one per
+// thread (the caller runs chunk 0 itself):
+//
+//   [ chunk 0 | chunk 1 | chunk 2 | chunk 3 ]
+//     caller    thread    thread    thread
+//
+// Each chunk runs the SEQUENTIAL algorithm, which already rolls its own
+// chunk back if a constructor throws. After the join, if any chunk failed,
+// every chunk that succeeded is destroyed too and the first exception is
+// rethrown - the same all-or-nothing result as the sequential version.
+//
+// Ranges under PARALLEL_MIN_BYTES, or with non-random-access iterators, just
+// run sequentially: starting threads costs tens of microseconds.
+
+namespace detail {
+
+inline constexpr size_t PARALLEL_MIN_BYTES = size_t(4) << 20;     // 4 MiB
+inline constexpr size_t PARALLEL_CHUNK_BYTES = size_t(1) << 20;   // per thread, at least
+
+template<typename... Its>
+inline constexpr bool all_random_access_v =
+    (is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Its>::iterator_category> &&
+     ...);
+
+inline size_t parallel_chunk_count(const execution::parallel_policy& policy, size_t bytes) noexcept {
+    if (bytes < PARALLEL_MIN_BYTES) {
+        return 1;
+    }
+    size_t workers = policy.threads ? policy.threads : std::thread::hardware_concurrency();
+    workers = std::max<size_t>(workers, 1);
+    return std::min(workers, std::max<size_t>(bytes / PARALLEL_CHUNK_BYTES, 1));
+}
+
+// run(lo, hi) on `chunks` slices of [0, n); on failure undo(lo, hi) every
+// slice that succeeded, then rethrow
+template<typename Run, typename Undo>
+void parallel_chunks(size_t chunks, size_t n, Run&& run, Undo&& undo) {
+    auto lo = [&](size_t c) { return n / chunks * c + std::min(c, n % chunks); };
+
+    std::vector<std::exception_ptr> errors(chunks);
+    std::vector<std::thread> threads;
+    threads.reserve(chunks - 1);
+
+    auto task = [&](size_t c) {
+        try {
+            run(lo(c), lo(c + 1));
+        } catch (...) {
+            errors[c] = std::current_exception();
+        }
+    };
+
+    size_t c = 1;
+    for (; c < chunks; c++) {
+        try {
+            threads.emplace_back(task, c);
+        } catch (...) {
+            break;   // out of threads - do the rest here
+        }
+    }
+    for (; c < chunks; c++) {
+        task(c);
+    }
+    task(0);
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    std::exception_ptr first_error;
+    for (const std::exception_ptr& e : errors) {
+        if (e) {
+            first_error = e;
+            break;
+        }
+    }
+    if (first_error) {
+        for (size_t i = 0; i < chunks; i++) {
+            if (!errors[i]) {
+                undo(lo(i), lo(i + 1));
+            }
+        }
+        std::rethrow_exception(first_error);
+    }
+}
+
+} // namespace detail
+
+// ============================================================================
+// uninitialized_copy / uninitialized_move
+// ============================================================================
+
+template<typename ExecutionPolicy, typename InputIt, typename ForwardIt,
+         typename = enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+ForwardIt uninitialized_copy(ExecutionPolicy&& policy, InputIt first, InputIt last, ForwardIt d_first) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+    using Policy = remove_cv_t<remove_reference_t<ExecutionPolicy>>;
+    if constexpr (is_same_v<Policy, execution::parallel_policy> &&
+                  detail::all_random_access_v<InputIt, ForwardIt>) {
+        const size_t n = size_t(last - first);
+        const size_t chunks = detail::parallel_chunk_count(policy, n * sizeof(value_type));
+        if (chunks > 1) {
+            detail::parallel_chunks(chunks, n,
+                [&](size_t lo, size_t hi) { career::uninitialized_copy(first + lo, first + hi, d_first + lo); },
+                [&](size_t lo, size_t hi) { career::destroy(d_first + lo, d_first + hi); });
+            return d_first + n;
+        }
+    }
+    return career::uninitialized_copy(first, last, d_first);
+}
+
+template<typename ExecutionPolicy, typename InputIt, typename ForwardIt,
+         typename = enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+ForwardIt uninitialized_move(ExecutionPolicy&& policy, InputIt first, InputIt last, ForwardIt d_first) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+    using Policy = remove_cv_t<remove_reference_t<ExecutionPolicy>>;
+    if constexpr (is_same_v<Policy, execution::parallel_policy> &&
+                  detail::all_random_access_v<InputIt, ForwardIt>) {
+        const size_t n = size_t(last - first);
+        const size_t chunks = detail::parallel_chunk_count(policy, n * sizeof(value_type));
+        if (chunks > 1) {
+            // As with the sequential version, a throw leaves the source
+            // elements that were already moved from in their moved-from state
+            detail::parallel_chunks(chunks, n,
+                [&](size_t lo, size_t hi) { career::uninitialized_move(first + lo, first + hi, d_first + lo); },
+                [&](size_t lo, size_t hi) { career::destroy(d_first + lo, d_first + hi); });
+            return d_first + n;
+        }
+    }
+    return career::uninitialized_move(first, last, d_first);
+}
+
+// ============================================================================
+// uninitialized_fill
+// ============================================================================
+
+template<typename ExecutionPolicy, typename ForwardIt, typename T,
+         typename = enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+void uninitialized_fill(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, const T& value) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+    using Policy = remove_cv_t<remove_reference_t<ExecutionPolicy>>;
+    if constexpr (is_same_v<Policy, execution::parallel_policy> && detail::all_random_access_v<ForwardIt>) {
+        const size_t n = size_t(last - first);
+        const size_t chunks = detail::parallel_chunk_count(policy, n * sizeof(value_type));
+        if (chunks > 1) {
+            detail::parallel_chunks(chunks, n,
+                [&](size_t lo, size_t hi) { career::uninitialized_fill(first + lo, first + hi, value); },
+                [&](size_t lo, size_t hi) { career::destroy(first + lo, first + hi); });
+            return;
+        }
+    }
+    career::uninitialized_fill(first, last, value);
+}
+
+// ============================================================================
+// destroy
+// ============================================================================
+
+template<typename ExecutionPolicy, typename ForwardIt,
+         typename = enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+void destroy(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last) noexcept {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+    using Policy = remove_cv_t<remove_reference_t<ExecutionPolicy>>;
+    if constexpr (is_trivially_destructible_v<value_type>) {
+        return;
+    } else if constexpr (is_same_v<Policy, execution::parallel_policy> &&
+                         detail::all_random_access_v<ForwardIt>) {
+        const size_t n = size_t(last - first);
+        const size_t chunks = detail::parallel_chunk_count(policy, n * sizeof(value_type));
+        if (chunks > 1) {
+            try {
+                detail::parallel_chunks(chunks, n,
+                    [&](size_t lo, size_t hi) { career::destroy(first + lo, first + hi); },
+                    [](size_t, size_t) {});
+                return;
+            } catch (...) {
+                // only the bookkeeping vectors can throw, before any chunk
+                // ran - fall through and destroy everything here
+            }
+        }
+    }
+    career::destroy(first, last);
+}
+
+} // namespace career
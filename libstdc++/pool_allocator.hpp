@@ -0,0 +1,255 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include "allocator_traits.hpp"
+
+namespace career {
+
+// ============================================================================
+// SIZE-CLASS POOL - the engine behind pool_allocator
+// ============================================================================
+//
+// Every request up to MAX_BLOCK bytes is rounded up to a multiple of GRANULE
+// (its "size class"). Each thread keeps one free list per size class:
+//
+//   class 0 (16 B):  [blk] -> [blk] -> [blk] -> null
+//   class 1 (32 B):  [blk] -> null
+//   ...
+//
+// allocate   = pop the head of the list        (no lock, no malloc)
+// deallocate = push the block back on the list (no lock, no free)
+// empty list = "refill": grab one CHUNK_SIZE slab from ::operator new and
+//              carve it into blocks of that class
+//
+// The free list is INTRUSIVE: a free block stores the `next` pointer inside
+// itself, so the pool needs no bookkeeping memory.
+//
+// NOTE: a block freed on another thread simply joins THAT thread's list.
+//       Slabs are therefore never handed back to the system (a block from
+//       any slab may live on any thread's list) - memory is recycled, not
+//       returned.
+//
+// Thread exit: the exiting thread's lists are spliced onto a global
+// "orphan" list per class (one lock per exit), and refill takes a whole
+// orphan list before carving a new slab - so a pool of short-lived worker
+// threads reuses the same slabs instead of leaking a thread's worth each.
+
+namespace detail {
+
+class size_class_pool {
+public:
+    static constexpr size_t GRANULE = 16;           // also the block alignment
+    static constexpr size_t MAX_BLOCK = 512;        // one career::Deque node
+    static constexpr size_t NUM_CLASSES = MAX_BLOCK / GRANULE;
+    static constexpr size_t CHUNK_SIZE = 64 * 1024; // slab per refill
+
+    static constexpr size_t class_index(size_t bytes) noexcept {
+        return bytes == 0 ? 0 : (bytes - 1) / GRANULE;  // 1..16 -> 0, 17..32 -> 1, ...
+    }
+
+    static constexpr size_t class_size(size_t index) noexcept {
+        return (index + 1) * GRANULE;
+    }
+
+    // bytes must be <= MAX_BLOCK
+    static void* allocate(size_t bytes) {
+        if (retired()) {
+            // no cache to keep the rest of a list in: take one block, hand
+            // the others straight back to the orphan list
+            FreeNode* node = refill(class_index(bytes));
+            if (FreeNode* rest = node->next) {
+                FreeNode* last = rest;
+                while (last->next) {
+                    last = last->next;
+                }
+                orphan(class_index(bytes), rest, last);
+            }
+            return node;
+        }
+        FreeNode*& head = local().heads[class_index(bytes)];
+        if (!head) {
+            head = refill(class_index(bytes));
+        }
+        FreeNode* node = head;
+        head = node->next;
+        return node;
+    }
+
+    static void deallocate(void* p, size_t bytes) noexcept {
+        FreeNode* node = static_cast<FreeNode*>(p);
+        if (retired()) {
+            // a later thread_local destructor on an exiting thread
+            node->next = nullptr;
+            orphan(class_index(bytes), node, node);
+            return;
+        }
+        FreeNode*& head = local().heads[class_index(bytes)];
+        node->next = head;
+        head = node;
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct ThreadCache {
+        FreeNode* heads[NUM_CLASSES] = {};
+
+        ~ThreadCache() {
+            for (size_t i = 0; i < NUM_CLASSES; i++) {
+                if (FreeNode* first = heads[i]) {
+                    FreeNode* last = first;
+                    while (last->next) {
+                        last = last->next;
+                    }
+                    orphan(i, first, last);
+                    heads[i] = nullptr;
+                }
+            }
+            retired() = true;
+        }
+    };
+
+    struct Orphans {
+        std::mutex mutex;
+        FreeNode* heads[NUM_CLASSES] = {};
+    };
+
+    static Orphans& orphans() noexcept {
+        static Orphans o;
+        return o;
+    }
+
+    // Splice [first, last] onto the global list of class `index`
+    static void orphan(size_t index, FreeNode* first, FreeNode* last) noexcept {
+        Orphans& o = orphans();
+        std::lock_guard<std::mutex> lock(o.mutex);
+        last->next = o.heads[index];
+        o.heads[index] = first;
+    }
+
+    // Set once this thread's ThreadCache is destroyed. Kept out of the
+    // cache in a plain bool, so reading it after teardown is well-defined.
+    static bool& retired() noexcept {
+        thread_local bool flag = false;
+        return flag;
+    }
+
+    static ThreadCache& local() noexcept {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    // Adopt the blocks exited threads left in this class, or else carve a
+    // fresh slab into a list of blocks (in address order, so consecutive
+    // allocations are adjacent in memory)
+    static FreeNode* refill(size_t index) {
+        {
+            Orphans& o = orphans();
+            std::lock_guard<std::mutex> lock(o.mutex);
+            if (FreeNode* adopted = o.heads[index]) {
+                o.heads[index] = nullptr;
+                return adopted;
+            }
+        }
+
+        const size_t block = class_size(index);
+        const size_t count = CHUNK_SIZE / block;
+        unsigned char* slab = static_cast<unsigned char*>(::operator new(CHUNK_SIZE));
+
+        FreeNode* head = nullptr;
+        for (size_t i = count; i-- > 0;) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(slab + i * block);
+            node->next = head;
+            head = node;
+        }
+        return head;
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// pool_allocator<T>
+// ============================================================================
+//
+// Stateless: every pool_allocator talks to the same (thread-local) pools, so
+// all instances compare equal and containers may freely swap/move memory
+// between them. Requests the pool can't serve - too big, or over-aligned -
+// fall back to career::allocator<T>.
+//
+// Works anywhere career::allocator does: career::allocator_traits and
+// std::allocator_traits find value_type, rebind and the converting
+// constructor. Tested with std containers only - career::Deque (map via
+// rebind to T*, 512 B nodes) is the intended user, but deque.hpp doesn't
+// compile yet.
+
+template<typename T>
+class pool_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = pool_allocator<U>;
+    };
+
+    pool_allocator() noexcept = default;
+
+    template<typename U>
+    pool_allocator(const pool_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+        if (uses_pool(n)) {
+            return static_cast<T*>(detail::size_class_pool::allocate(n * sizeof(T)));
+        }
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (uses_pool(n)) {
+            detail::size_class_pool::deallocate(p, n * sizeof(T));
+        } else {
+            allocator<T>().deallocate(p, n);
+        }
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return allocator<T>().max_size();
+    }
+
+private:
+    static constexpr bool uses_pool(size_type n) noexcept {
+        return alignof(T) <= detail::size_class_pool::GRANULE &&
+               n <= detail::size_class_pool::MAX_BLOCK / sizeof(T);
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const pool_allocator<T>&, const pool_allocator<U>&) noexcept {
+    return true; // all pools are shared
+}
+
+template<typename T, typename U>
+bool operator!=(const pool_allocator<T>&, const pool_allocator<U>&) noexcept {
+    return false;
+}
+
+} // namespace career
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include "allocator_traits.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace career {
+
+// ============================================================================
+// REMAP ALLOCATOR - big buffers that grow without copying
+// ============================================================================
+//
+// Blocks of LARGE_BLOCK or more get their own anonymous mapping. Owning the
+// mapping lets the kernel grow it by remapping pages (mremap) - O(pages)
+// page-table work, no O(n) copy:
+//
+//   try_expand : mremap(p, old, new, 0)              grow in place; fails if
+//                                                    the next pages are taken
+//   reallocate : mremap(p, old, new, MREMAP_MAYMOVE) may move, never copies
+//
+// Opt-in, not the default: every mapping is a fresh mmap + munmap, and its
+// pages fault in again on first touch. glibc's malloc instead raises its
+// mmap threshold after the first big free and reuses heap it already
+// touched, which wins for a container that is built and dropped over and
+// over. Use this one for a few long-lived buffers that grow very large.
+//
+//   Vector<int, remap_allocator<int>> samples;
+//
+// Small blocks go through career::allocator.
+
+template<typename T>
+class remap_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    static constexpr size_type LARGE_BLOCK = size_type(1) << 20;
+
+    template<typename U>
+    struct rebind {
+        using other = remap_allocator<U>;
+    };
+
+    remap_allocator() noexcept = default;
+
+    template<typename U>
+    remap_allocator(const remap_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+#if defined(__linux__)
+        if (is_large(n)) {
+            void* m = ::mmap(nullptr, page_round(n * sizeof(T)), PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (m == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(m);
+        }
+#endif
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+#if defined(__linux__)
+        if (is_large(n)) {
+            ::munmap(p, page_round(n * sizeof(T)));
+            return;
+        }
+#endif
+        allocator<T>().deallocate(p, n);
+    }
+
+    // =========================================================
+    // GROWTH HOOKS (found by allocator_traits)
+    // =========================================================
+    //
+    //   try_expand : grow the block at p in place. true = p now holds
+    //                new_n elements; false = nothing changed, relocate.
+    //   reallocate : trivially copyable T only. Move the buffer to a
+    //                block of new_n elements, returning its new address.
+
+    bool try_expand(T* p, size_type old_n, size_type new_n) noexcept {
+#if defined(__linux__)
+        if (is_large(old_n) && new_n >= old_n && new_n <= max_size()) {
+            const size_t old_len = page_round(old_n * sizeof(T));
+            const size_t new_len = page_round(new_n * sizeof(T));
+            return old_len == new_len || ::mremap(p, old_len, new_len, 0) != MAP_FAILED;
+        }
+#else
+        (void)p; (void)old_n; (void)new_n;
+#endif
+        return false;
+    }
+
+    template<typename U = T, typename = std::enable_if_t<std::is_trivially_copyable_v<U>>>
+    [[nodiscard]] T* reallocate(T* p, size_type old_n, size_type new_n) {
+        if (new_n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+#if defined(__linux__)
+        if (is_large(old_n) && is_large(new_n)) {
+            void* q = ::mremap(p, page_round(old_n * sizeof(T)), page_round(new_n * sizeof(T)),
+                               MREMAP_MAYMOVE);
+            if (q == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(q);
+        }
+#endif
+        T* q = allocate(new_n);
+        if (old_n) {
+            std::memcpy(q, p, std::min(old_n, new_n) * sizeof(T));
+            deallocate(p, old_n);
+        }
+        return q;
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return allocator<T>().max_size();
+    }
+
+private:
+    static constexpr bool is_large(size_type n) noexcept {
+        return n * sizeof(T) >= LARGE_BLOCK && alignof(T) <= 4096;
+    }
+
+#if defined(__linux__)
+    static size_t page_round(size_t bytes) noexcept {
+        static const size_t page = size_t(::sysconf(_SC_PAGESIZE));
+        return (bytes + page - 1) / page * page;
+    }
+#endif
+};
+
+template<typename T, typename U>
+bool operator==(const remap_allocator<T>&, const remap_allocator<U>&) noexcept {
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const remap_allocator<T>&, const remap_allocator<U>&) noexcept {
+    return false;
+}
+
+} // namespace career
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <type_traits>
+
+namespace career {
+
+// ============================================================================
+// SEGMENTED ITERATORS
+// ============================================================================
+//
+// A Deque iterator walks a range that is really a chain of contiguous
+// buffers. Every ++ has to check "did I hit the end of this buffer?":
+//
+//   map:  [node0][node1][node2]
+//            |      |      |
+//            v      v      v
+//         [.. ab] [cdefgh] [ij ..]     one segment per node
+//              ^                ^
+//            first            last
+//
+// An algorithm that knows this can run its inner loop over each buffer with
+// plain pointers instead - no boundary checks, and for trivial types one
+// memmove per buffer. The protocol (after Austern, "Segmented Iterators and
+// Hierarchical Algorithms"):
+//
+//   segment_iterator               walks the segments (a Deque map pointer)
+//   local_iterator                 walks inside one segment (element pointer)
+//   segment(it)                    the segment `it` is in
+//   local(it)                      `it` as a local iterator
+//   segment_begin(s) / segment_end(s)   the whole segment s as a local range
+//
+// A container opts in by specializing segmented_iterator_traits for its
+// iterator with is_segmented = true (see DequeIterator in deque.hpp). The
+// career::uninitialized_* algorithms check is_segmented_iterator_v.
+
+template<typename Iterator>
+struct segmented_iterator_traits {
+    static constexpr bool is_segmented = false;
+};
+
+template<typename Iterator>
+inline constexpr bool is_segmented_iterator_v = segmented_iterator_traits<Iterator>::is_segmented;
+
+} // namespace career
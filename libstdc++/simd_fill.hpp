@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CAREER_SIMD_FILL_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace career {
+
+// ============================================================================
+// SIMD FILL - pattern fill kernels for the uninitialized_* fast paths
+// ============================================================================
+//
+// Fills [dst, dst + bytes) with one element's bytes repeated. The element
+// size must divide 16 (1, 2, 4, 8 or 16 bytes), so a 16/32-byte register
+// holds a whole number of elements and every aligned store writes the same
+// register:
+//
+//   pattern (8-byte T) : [ABCDEFGH][ABCDEFGH][ABCDEFGH][ABCDEFGH]  = one ymm
+//
+//   dst                 32-aligned                         end
+//   |head (memcpy)|  ymm  |  ymm  |  ymm  | ... |  ymm  |tail (memcpy)|
+//
+// If dst isn't 32-aligned the first aligned store starts mid-element, so the
+// register is loaded from the pattern at that phase (head % sizeof(T)).
+//
+// Two kinds of store:
+//   regular   : stays in cache - right when the caller reads the data next
+//   streaming : non-temporal (movntdq), bypasses the cache. Above
+//               STREAM_THRESHOLD a fill is bigger than the caches anyway, so
+//               regular stores would only evict everything else (and read
+//               each line in before overwriting it)
+//
+// The kernel (AVX2, else SSE2) is chosen once at runtime from CPUID, so the
+// header needs no -mavx2; non-x86 builds fall back to memset / memcpy.
+
+namespace detail {
+
+enum class simd_level { none, sse2, avx2 };
+
+inline simd_level detect_simd_level() noexcept {
+#if defined(CAREER_SIMD_FILL_X86)
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return simd_level::none;
+    }
+    const bool sse2 = edx & bit_SSE2;
+    // AVX2 needs the CPU bit AND the OS saving ymm state (OSXSAVE + XCR0)
+    const bool osxsave = ecx & bit_OSXSAVE;
+    bool avx2 = false;
+    if (osxsave && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_AVX2)) {
+        unsigned xcr0_lo, xcr0_hi;
+        __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        avx2 = (xcr0_lo & 0x6) == 0x6;   // xmm + ymm state enabled
+    }
+    return avx2 ? simd_level::avx2 : sse2 ? simd_level::sse2 : simd_level::none;
+#else
+    return simd_level::none;
+#endif
+}
+
+inline simd_level simd_support() noexcept {
+    static const simd_level level = detect_simd_level();
+    return level;
+}
+
+// Past this, a fill evicts more than it could ever keep in cache
+inline constexpr size_t STREAM_THRESHOLD = size_t(4) << 20;   // 4 MiB
+
+// Smaller fills aren't worth leaving the scalar / memset path for
+inline constexpr size_t SIMD_FILL_MIN = 256;
+
+inline constexpr bool is_simd_fill_size(size_t size) noexcept {
+    return size != 0 && size <= 16 && 16 % size == 0;
+}
+
+// 64 bytes of the element repeated: any phase + 32 bytes stays in bounds
+struct fill_pattern {
+    alignas(32) unsigned char bytes[64];
+
+    fill_pattern(const void* value, size_t size) noexcept {
+        for (size_t i = 0; i < sizeof(bytes); i += size) {
+            std::memcpy(bytes + i, value, size);
+        }
+    }
+};
+
+#if defined(CAREER_SIMD_FILL_X86)
+
+template<bool Stream>
+__attribute__((target("avx2"))) void fill_avx2(unsigned char* p, size_t bytes, const fill_pattern& pat,
+                                                size_t size) noexcept {
+    unsigned char* const end = p + bytes;
+    size_t head = size_t(-reinterpret_cast<uintptr_t>(p)) & 31;
+    std::memcpy(p, pat.bytes, head);
+    p += head;
+    const size_t phase = head % size;
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pat.bytes + phase));
+
+    size_t blocks = size_t(end - p) / 32;
+    for (; blocks >= 4; blocks -= 4, p += 128) {
+        __m256i* q = reinterpret_cast<__m256i*>(p);
+        if constexpr (Stream) {
+            _mm256_stream_si256(q, v);
+            _mm256_stream_si256(q + 1, v);
+            _mm256_stream_si256(q + 2, v);
+            _mm256_stream_si256(q + 3, v);
+        } else {
+            _mm256_store_si256(q, v);
+            _mm256_store_si256(q + 1, v);
+            _mm256_store_si256(q + 2, v);
+            _mm256_store_si256(q + 3, v);
+        }
+    }
+    for (; blocks; blocks--, p += 32) {
+        if constexpr (Stream) {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(p), v);
+        } else {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(p), v);
+        }
+    }
+    if constexpr (Stream) {
+        _mm_sfence();   // order the weakly-ordered NT stores before anything after
+    }
+    std::memcpy(p, pat.bytes + phase, size_t(end - p));
+}
+
+template<bool Stream>
+__attribute__((target("sse2"))) void fill_sse2(unsigned char* p, size_t bytes, const fill_pattern& pat,
+                                               size_t size) noexcept {
+    unsigned char* const end = p + bytes;
+    size_t head = size_t(-reinterpret_cast<uintptr_t>(p)) & 15;
+    std::memcpy(p, pat.bytes, head);
+    p += head;
+    const size_t phase = head % size;
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pat.bytes + phase));
+
+    size_t blocks = size_t(end - p) / 16;
+    for (; blocks >= 4; blocks -= 4, p += 64) {
+        __m128i* q = reinterpret_cast<__m128i*>(p);
+        if constexpr (Stream) {
+            _mm_stream_si128(q, v);
+            _mm_stream_si128(q + 1, v);
+            _mm_stream_si128(q + 2, v);
+            _mm_stream_si128(q + 3, v);
+        } else {
+            _mm_store_si128(q, v);
+            _mm_store_si128(q + 1, v);
+            _mm_store_si128(q + 2, v);
+            _mm_store_si128(q + 3, v);
+        }
+    }
+    for (; blocks; blocks--, p += 16) {
+        if constexpr (Stream) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(p), v);
+        } else {
+            _mm_store_si128(reinterpret_cast<__m128i*>(p), v);
+        }
+    }
+    if constexpr (Stream) {
+        _mm_sfence();
+    }
+    std::memcpy(p, pat.bytes + phase, size_t(end - p));
+}
+
+#endif
+
+// Fill `bytes` (a multiple of size) at dst with copies of value[0, size).
+// Returns false if no SIMD kernel applies - the caller keeps its own path.
+inline bool simd_fill(void* dst, size_t bytes, const void* value, size_t size) noexcept {
+#if defined(CAREER_SIMD_FILL_X86)
+    if (bytes < SIMD_FILL_MIN || !is_simd_fill_size(size)) {
+        return false;
+    }
+    const simd_level level = simd_support();
+    if (level == simd_level::none) {
+        return false;
+    }
+    const fill_pattern pat(value, size);
+    unsigned char* p = static_cast<unsigned char*>(dst);
+    const bool stream = bytes >= STREAM_THRESHOLD;
+    if (level == simd_level::avx2) {
+        stream ? fill_avx2<true>(p, bytes, pat, size) : fill_avx2<false>(p, bytes, pat, size);
+    } else {
+        stream ? fill_sse2<true>(p, bytes, pat, size) : fill_sse2<false>(p, bytes, pat, size);
+    }
+    return true;
+#else
+    (void)dst; (void)bytes; (void)value; (void)size;
+    return false;
+#endif
+}
+
+} // namespace detail
+
+} // namespace career
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+
+#include "type_traits.hpp"
+
+namespace career {
+
+// ============================================================================
+// LAYOUT RULES (see Padding.cpp)
+// ============================================================================
+//
+// Every member starts at a multiple of its own alignment, and the struct's
+// size is rounded up to its largest member's alignment so an array of them
+// keeps every element aligned:
+//
+//   struct { char a; double d; int b; }
+//
+//   offset: 0   1       8               16      20      24
+//           [a ][ pad 7 ][      d       ][  b   ][ pad 4 ]   sizeof = 24
+//
+// The helpers below apply the same rules at compile time, so a container can
+// work out how a T lands in a byte budget without a hand-tuned constant.
+
+inline constexpr size_t align_up(size_t offset, size_t alignment) noexcept {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// bytes inserted before a member of `alignment` placed at `offset`
+inline constexpr size_t padding_before(size_t offset, size_t alignment) noexcept {
+    return align_up(offset, alignment) - offset;
+}
+
+// sizeof / alignof / total padding of `struct { Ts... }`, members in order
+template<typename... Ts>
+struct struct_layout {
+private:
+    static constexpr size_t member_sizes[] = {sizeof(Ts)...};
+    static constexpr size_t member_aligns[] = {alignof(Ts)...};
+
+    static constexpr size_t compute_align() noexcept {
+        size_t result = 1;
+        for (size_t a : member_aligns) {
+            result = a > result ? a : result;
+        }
+        return result;
+    }
+
+    static constexpr size_t compute_end() noexcept {
+        size_t offset = 0;
+        for (size_t i = 0; i < sizeof...(Ts); i++) {
+            offset = align_up(offset, member_aligns[i]) + member_sizes[i];
+        }
+        return offset;
+    }
+
+public:
+    static constexpr size_t alignment = compute_align();
+    static constexpr size_t size = align_up(compute_end(), alignment);
+    static constexpr size_t padding = size - (sizeof(Ts) + ...);
+};
+
+// ============================================================================
+// STORAGE POLICY - where does a T go, given a byte budget?
+// ============================================================================
+//
+//   storage_policy<T, Budget, BufferAlign>::kind
+//
+//   INLINE        fits the buffer and is trivially copyable: the owner can
+//                 memcpy / swap the raw bytes, no per-type copy or destroy
+//   SMALL_BUFFER  fits, but has a real copy / destructor; it can still live
+//                 in the buffer as long as moving it can't throw (a move of
+//                 the owner has to move the buffer, and must stay noexcept)
+//   HEAP          too big, over-aligned for the buffer, or throwing move
+//
+// `padding` is the part of the budget a T in the buffer leaves unused.
+
+enum class storage_kind { INLINE, SMALL_BUFFER, HEAP };
+
+template<typename T, size_t Budget, size_t BufferAlign = alignof(std::max_align_t)>
+struct storage_policy {
+    static constexpr bool fits = sizeof(T) <= Budget && alignof(T) <= BufferAlign;
+
+    static constexpr storage_kind kind =
+        !fits                                ? storage_kind::HEAP
+        : is_trivially_copyable_v<T>         ? storage_kind::INLINE
+        : is_nothrow_move_constructible_v<T> ? storage_kind::SMALL_BUFFER
+                                             : storage_kind::HEAP;
+
+    static constexpr bool is_inline = kind == storage_kind::INLINE;
+    static constexpr bool in_buffer = kind != storage_kind::HEAP;
+    static constexpr size_t padding = fits ? Budget - sizeof(T) : 0;
+};
+
+// ============================================================================
+// BLOCK LAYOUT - how many T per allocation, given a byte budget?
+// ============================================================================
+//
+// For containers that allocate T in blocks (a Deque node, a Vector's first
+// buffer). sizeof(T) is already a multiple of alignof(T), so T[count] packs
+// with no padding between elements - only the tail of the budget is lost:
+//
+//   Budget = 512, sizeof(T) = 24:
+//   [ T ][ T ] ... [ T ][pad 8]     count = 21, bytes = 504
+//
+// A T bigger than the budget still gets MinCount elements per block.
+
+template<typename T, size_t Budget, size_t MinCount = 1>
+struct block_layout {
+    static_assert(MinCount > 0, "a block holds at least one element");
+
+    static constexpr size_t count = Budget / sizeof(T) > MinCount ? Budget / sizeof(T) : MinCount;
+    static constexpr size_t bytes = count * sizeof(T);
+    static constexpr size_t padding = bytes < Budget ? Budget - bytes : 0;
+};
+
+// One cache line: the smallest allocation worth making for a growing buffer
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+namespace detail {
+namespace storage_policy_checks {
+
+// Padding.cpp's examples
+static_assert(struct_layout<char, double, int>::size == 24);
+static_assert(struct_layout<char, double, int>::padding == 11);
+static_assert(struct_layout<char, char, int, int, double, int>::size == 32);
+static_assert(struct_layout<int, float, char>::size == 12);
+static_assert(struct_layout<int, long long, char>::size == 24);
+static_assert(struct_layout<char, int, long long>::size == 16);
+
+struct NonTrivial {
+    NonTrivial(const NonTrivial&);
+    NonTrivial(NonTrivial&&) noexcept;
+};
+struct ThrowingMove {
+    ThrowingMove(ThrowingMove&&);
+};
+
+static_assert(storage_policy<void*, 16>::kind == storage_kind::INLINE);
+static_assert(storage_policy<NonTrivial, 16>::kind == storage_kind::SMALL_BUFFER);
+static_assert(storage_policy<ThrowingMove, 16>::kind == storage_kind::HEAP);
+static_assert(storage_policy<char[32], 16>::kind == storage_kind::HEAP);
+static_assert(storage_policy<int, 16>::padding == 12);
+
+static_assert(block_layout<int, 512>::count == 128);
+static_assert(block_layout<char[24], 512>::count == 21 && block_layout<char[24], 512>::padding == 8);
+static_assert(block_layout<char[1000], 512>::count == 1);
+
+} // namespace storage_policy_checks
+} // namespace detail
+
+} // namespace career
@@ -0,0 +1,393 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "allocator_traits.hpp"
+
+namespace career {
+
+// ============================================================================
+// THREAD CACHE - a per-thread front end over career::allocator
+// ============================================================================
+//
+// Every small block carries a 16-byte header naming the thread cache that
+// owns it:
+//
+//   [owner | class][payload ..........]
+//                  ^ what allocate() returns
+//
+// allocate   : pop this thread's local free list for the size class;
+//              empty -> first collect blocks other threads sent back,
+//              then fall back to career::allocator
+// deallocate : our block   -> push on the local list (bounded: past
+//                             MAX_LOCAL, half the list goes back to
+//                             career::allocator)
+//              their block -> add to a pending BATCH for that owner;
+//                             every BATCH_SIZE blocks (or when the owner
+//                             changes) the whole batch is spliced onto the
+//                             owner's remote list with ONE CAS
+//
+//   producer thread                          consumer thread
+//   allocate() -> local list                 deallocate(producer's block)
+//        ^                                          |
+//        |   remote list (lock-free MPSC stack)     v
+//        +---- exchange(nullptr) <--- CAS push <--- batch of 32
+//
+// Many threads push (CAS on the head), only the owner pops - and it takes
+// the whole list at once with exchange(), so there is no ABA problem.
+//
+// A batch is also sent by thread_cache_allocator::flush() - call it before a
+// consumer blocks, or its last < BATCH_SIZE frees sit out of the
+// producer's reach.
+//
+// Thread exit: local lists go back to career::allocator, and the cache
+// itself is parked for the next new thread to adopt. Caches live until
+// process exit, so a block's owner pointer stays valid however late it is
+// freed; anything sent to a parked cache is collected by its adopter.
+// Frees that come after the exit (from a later thread_local destructor)
+// skip the dead Local and go straight to the owner's remote list.
+
+namespace detail {
+
+class thread_cache {
+public:
+    static constexpr size_t GRANULE = 16;
+    static constexpr size_t MAX_BLOCK = 1024;
+    static constexpr size_t NUM_CLASSES = MAX_BLOCK / GRANULE;
+    static constexpr size_t MAX_LOCAL = 128;     // free blocks kept per class
+    static constexpr size_t BATCH_SIZE = 32;     // remote frees per CAS
+
+    static constexpr size_t class_index(size_t bytes) noexcept {
+        return bytes == 0 ? 0 : (bytes - 1) / GRANULE;
+    }
+
+    // bytes must be <= MAX_BLOCK
+    static void* allocate(size_t bytes) {
+        const size_t cls = class_index(bytes);
+        if (retired()) {
+            // a later thread_local destructor on an exiting thread: borrow a
+            // parked cache just to own the block, so its free has a home
+            thread_cache* owner = adopt();
+            Block* b = new_block(owner, cls);
+            park(owner);
+            return b->payload();
+        }
+        thread_cache& self = *local().cache;
+        if (!self._free[cls]) {
+            self.collect_remote();
+        }
+        Block* b = self._free[cls];
+        if (b) {
+            self._free[cls] = b->next;
+            self._count[cls]--;
+        } else {
+            b = new_block(&self, cls);
+        }
+        return b->payload();
+    }
+
+    // Send this thread's pending batch of remote frees now. A consumer
+    // that goes idle holding fewer than BATCH_SIZE blocks would otherwise
+    // keep them from their producer until the owner changes or it exits.
+    static void flush() noexcept {
+        if (retired()) {
+            return;
+        }
+        try {
+            local().flush_batch();
+        } catch (...) {
+            // no cache could be made, so nothing was ever batched
+        }
+    }
+
+    static void deallocate(void* p) noexcept {
+        Block* b = Block::from_payload(p);
+        if (retired()) {
+            // our Local is gone and its cache parked (maybe already adopted
+            // by another thread): never touch it, just send the block home
+            b->owner->push_remote(b, b);
+            return;
+        }
+        Local* loc;
+        try {
+            loc = &local();
+        } catch (...) {
+            // First touch on this thread and no cache could be made: the
+            // block isn't ours, so hand it straight back to its owner
+            b->owner->push_remote(b, b);
+            return;
+        }
+        if (b->owner == loc->cache) {
+            loc->cache->push_local(b);
+        } else {
+            loc->send_remote(b);
+        }
+    }
+
+private:
+    struct Block {
+        thread_cache* owner;
+        size_t cls;
+        Block* next;            // overlays the payload while the block is free
+
+        void* payload() noexcept {
+            return &next;
+        }
+
+        static Block* from_payload(void* p) noexcept {
+            return reinterpret_cast<Block*>(static_cast<unsigned char*>(p) - HEADER);
+        }
+    };
+
+    static constexpr size_t HEADER = offsetof(Block, next);   // 16 on 64-bit
+
+    Block* _free[NUM_CLASSES] = {};
+    size_t _count[NUM_CLASSES] = {};
+    std::atomic<Block*> _remote{nullptr};
+
+    static size_t block_bytes(size_t cls) noexcept {
+        return HEADER + (cls + 1) * GRANULE;
+    }
+
+    static Block* new_block(thread_cache* owner, size_t cls) {
+        void* raw = allocator<unsigned char>().allocate(block_bytes(cls));
+        return ::new (raw) Block{owner, cls, nullptr};
+    }
+
+    static void free_block(Block* b) noexcept {
+        allocator<unsigned char>().deallocate(reinterpret_cast<unsigned char*>(b), block_bytes(b->cls));
+    }
+
+    void push_local(Block* b) noexcept {
+        const size_t cls = b->cls;
+        b->next = _free[cls];
+        _free[cls] = b;
+        if (++_count[cls] > MAX_LOCAL) {
+            trim(cls, MAX_LOCAL / 2);
+        }
+    }
+
+    // Give all but `keep` blocks of a class back to career::allocator
+    void trim(size_t cls, size_t keep) noexcept {
+        while (_count[cls] > keep) {
+            Block* b = _free[cls];
+            _free[cls] = b->next;
+            _count[cls]--;
+            free_block(b);
+        }
+    }
+
+    // MPSC producer side: splice first..last onto our remote list
+    void push_remote(Block* first, Block* last) noexcept {
+        Block* head = _remote.load(std::memory_order_relaxed);
+        do {
+            last->next = head;
+        } while (!_remote.compare_exchange_weak(head, first, std::memory_order_release,
+                                                std::memory_order_relaxed));
+    }
+
+    // MPSC consumer side: take everything other threads sent us. Returned
+    // blocks are kept in full (a producer stage needs every one of them
+    // back); the MAX_LOCAL bound applies on the next local free.
+    void collect_remote() noexcept {
+        if (!_remote.load(std::memory_order_relaxed)) {
+            return;   // common case: skip the locked exchange
+        }
+        Block* b = _remote.exchange(nullptr, std::memory_order_acquire);
+        while (b) {
+            Block* next = b->next;
+            b->next = _free[b->cls];
+            _free[b->cls] = b;
+            _count[b->cls]++;
+            b = next;
+        }
+    }
+
+    void release_all() noexcept {
+        collect_remote();
+        for (size_t cls = 0; cls < NUM_CLASSES; cls++) {
+            trim(cls, 0);
+        }
+    }
+
+    // ┌─────────────────────────────────────────────────────────────────────┐
+    // │ Local: the per-thread handle - which cache we own, plus the batch    │
+    // │ of remote frees we haven't sent yet                                  │
+    // └─────────────────────────────────────────────────────────────────────┘
+    struct Local {
+        thread_cache* cache = adopt();
+        thread_cache* batch_owner = nullptr;
+        Block* batch_first = nullptr;
+        Block* batch_last = nullptr;
+        size_t batch_count = 0;
+
+        void send_remote(Block* b) noexcept {
+            if (b->owner != batch_owner) {
+                flush_batch();
+                batch_owner = b->owner;
+            }
+            b->next = batch_first;
+            batch_first = b;
+            if (!batch_last) {
+                batch_last = b;
+            }
+            if (++batch_count == BATCH_SIZE) {
+                flush_batch();
+            }
+        }
+
+        void flush_batch() noexcept {
+            if (batch_first) {
+                batch_owner->push_remote(batch_first, batch_last);
+            }
+            batch_first = batch_last = nullptr;
+            batch_count = 0;
+        }
+
+        ~Local() {
+            flush_batch();
+            cache->release_all();
+            park(cache);
+            retired() = true;
+        }
+    };
+
+    struct Parked {
+        std::mutex mutex;
+        std::vector<thread_cache*> caches;
+
+        // Process exit: all other threads are gone, so nothing can still
+        // send blocks to these caches
+        ~Parked() {
+            for (thread_cache* c : caches) {
+                c->release_all();
+                delete c;
+            }
+        }
+    };
+
+    static Parked& parked() noexcept {
+        static Parked p;
+        return p;
+    }
+
+    static thread_cache* adopt() {
+        Parked& p = parked();
+        std::lock_guard<std::mutex> lock(p.mutex);
+        if (p.caches.empty()) {
+            return new thread_cache();   // only deleted at process exit
+        }
+        thread_cache* c = p.caches.back();
+        p.caches.pop_back();
+        return c;
+    }
+
+    static void park(thread_cache* c) noexcept {
+        Parked& p = parked();
+        std::lock_guard<std::mutex> lock(p.mutex);
+        p.caches.push_back(c);
+    }
+
+    // Set once this thread's Local is destroyed. A plain bool, so reading
+    // it after thread_local teardown has begun is still well-defined.
+    static bool& retired() noexcept {
+        thread_local bool flag = false;
+        return flag;
+    }
+
+    // Not noexcept: the first call on a thread adopts a cache, which may
+    // have to allocate one (bad_alloc). A throw leaves loc uninitialized,
+    // so the next call tries again.
+    static Local& local() {
+        thread_local Local loc;
+        return loc;
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// thread_cache_allocator<T>
+// ============================================================================
+//
+// Stateless like pool_allocator, so any instance may free any block - even
+// one allocated on another thread, which is the whole point: pipeline
+// stages that allocate on one thread and free on the next no longer
+// contend inside malloc. Blocks over MAX_BLOCK or over-aligned go straight
+// to career::allocator<T>.
+
+template<typename T>
+class thread_cache_allocator {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = thread_cache_allocator<U>;
+    };
+
+    thread_cache_allocator() noexcept = default;
+
+    template<typename U>
+    thread_cache_allocator(const thread_cache_allocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_type n) {
+        if (n > max_size()) {
+            throw std::bad_array_new_length();
+        }
+        if (uses_cache(n)) {
+            return static_cast<T*>(detail::thread_cache::allocate(n * sizeof(T)));
+        }
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) noexcept {
+        if (uses_cache(n)) {
+            detail::thread_cache::deallocate(p);
+        } else {
+            allocator<T>().deallocate(p, n);
+        }
+    }
+
+    // Hand this thread's batched cross-thread frees back to their owners.
+    // Call it when a consumer is about to block or go idle.
+    static void flush() noexcept {
+        detail::thread_cache::flush();
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return allocator<T>().max_size();
+    }
+
+private:
+    static constexpr bool uses_cache(size_type n) noexcept {
+        return alignof(T) <= detail::thread_cache::GRANULE &&
+               n <= detail::thread_cache::MAX_BLOCK / sizeof(T);
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) noexcept {
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) noexcept {
+    return false;
+}
+
+} // namespace career
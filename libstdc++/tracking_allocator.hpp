@@ -0,0 +1,311 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+
+#include "allocator_traits.hpp"
+
+namespace career {
+
+// ============================================================================
+// allocation_report - a merged snapshot of one call site's counters
+// ============================================================================
+//
+// Histogram buckets are powers of two of the REQUEST size in bytes:
+//   bucket 0: 1..16 B   bucket 1: 17..32 B   ...   last bucket: everything above
+
+struct allocation_report {
+    static constexpr size_t NUM_BUCKETS = 20;   // up to 4 MiB, then "bigger"
+
+    unsigned long long allocations = 0;
+    unsigned long long deallocations = 0;
+    long long bytes_in_use = 0;
+    long long peak_bytes = 0;
+    unsigned long long histogram[NUM_BUCKETS] = {};
+
+    static constexpr size_t bucket_of(size_t bytes) noexcept {
+        size_t bucket = 0;
+        for (size_t limit = 16; bytes > limit && bucket + 1 < NUM_BUCKETS; limit <<= 1) {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    static constexpr size_t bucket_limit(size_t bucket) noexcept {
+        return size_t(16) << bucket;
+    }
+
+    void print(const char* site, std::FILE* out = stdout) const {
+        std::fprintf(out, "[%s] allocs %llu  frees %llu  in use %lld B  peak %lld B\n",
+                     site, allocations, deallocations, bytes_in_use, peak_bytes);
+        for (size_t b = 0; b < NUM_BUCKETS; b++) {
+            if (histogram[b] == 0) {
+                continue;
+            }
+            if (b + 1 < NUM_BUCKETS) {
+                std::fprintf(out, "    <= %9zu B : %llu\n", bucket_limit(b), histogram[b]);
+            } else {
+                std::fprintf(out, "    >  %9zu B : %llu\n", bucket_limit(b - 1), histogram[b]);
+            }
+        }
+    }
+};
+
+// ============================================================================
+// tracking_stats<Tag> - the per-call-site counters behind tracking_allocator
+// ============================================================================
+//
+// Hot path (allocate/deallocate) touches only THIS thread's counters:
+//
+//   thread A: [allocs | frees | in_use | histogram]  --+
+//   thread B: [allocs | frees | in_use | histogram]  --+--> report() sums
+//   exited  : retired totals (merged at thread exit) --+    under a mutex
+//
+// Counters are std::atomic only so report() may read them while the owner
+// writes; the owner does plain relaxed load+store, no locked RMW.
+//
+// Peak bytes need a GLOBAL in-use figure. Each thread pushes its in-use
+// delta to one shared atomic every FLUSH_BYTES, and on every allocate
+// keeps a local max of (shared figure + its own unflushed delta). report()
+// takes the max over all threads: exact for one thread, and off by at most
+// FLUSH_BYTES per OTHER thread.
+
+namespace detail {
+
+template<typename Tag>
+class tracking_stats {
+public:
+    static constexpr long long FLUSH_BYTES = 64 * 1024;
+
+    static void on_allocate(size_t bytes) noexcept {
+        ThreadCounters& c = local();
+        bump(c.allocations, 1);
+        bump(c.histogram[allocation_report::bucket_of(bytes)], 1);
+        add_in_use(c, static_cast<long long>(bytes));
+
+        const long long seen = registry().flushed_in_use.load(std::memory_order_relaxed) + c.pending;
+        if (seen > c.peak_bytes.load(std::memory_order_relaxed)) {
+            c.peak_bytes.store(seen, std::memory_order_relaxed);
+        }
+    }
+
+    static void on_deallocate(size_t bytes) noexcept {
+        ThreadCounters& c = local();
+        bump(c.deallocations, 1);
+        add_in_use(c, -static_cast<long long>(bytes));
+    }
+
+    static allocation_report report() {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+
+        allocation_report r = reg.retired;
+        for (ThreadCounters* c = reg.head; c; c = c->next) {
+            c->merge_into(r);
+        }
+        if (r.bytes_in_use > r.peak_bytes) {
+            r.peak_bytes = r.bytes_in_use;
+        }
+        return r;
+    }
+
+private:
+    struct ThreadCounters;
+
+    struct Registry {
+        std::mutex mutex;
+        ThreadCounters* head = nullptr;       // live threads
+        allocation_report retired;            // threads that have exited
+        std::atomic<long long> flushed_in_use{0};
+    };
+
+    struct ThreadCounters {
+        std::atomic<unsigned long long> allocations{0};
+        std::atomic<unsigned long long> deallocations{0};
+        std::atomic<long long> bytes_in_use{0};   // may go negative: freed on another thread
+        std::atomic<long long> peak_bytes{0};     // highest global in-use this thread saw
+        std::atomic<unsigned long long> histogram[allocation_report::NUM_BUCKETS] = {};
+        long long pending = 0;                    // in-use delta not yet flushed (owner only)
+        ThreadCounters* prev = nullptr;
+        ThreadCounters* next = nullptr;
+
+        ThreadCounters() {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            next = reg.head;
+            if (next) {
+                next->prev = this;
+            }
+            reg.head = this;
+        }
+
+        ~ThreadCounters() {
+            Registry& reg = registry();
+            flush(*this);
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            merge_into(reg.retired);
+            (prev ? prev->next : reg.head) = next;
+            if (next) {
+                next->prev = prev;
+            }
+        }
+
+        void merge_into(allocation_report& r) const noexcept {
+            r.allocations += allocations.load(std::memory_order_relaxed);
+            r.deallocations += deallocations.load(std::memory_order_relaxed);
+            r.bytes_in_use += bytes_in_use.load(std::memory_order_relaxed);
+            const long long peak = peak_bytes.load(std::memory_order_relaxed);
+            if (peak > r.peak_bytes) {
+                r.peak_bytes = peak;
+            }
+            for (size_t b = 0; b < allocation_report::NUM_BUCKETS; b++) {
+                r.histogram[b] += histogram[b].load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // Function-local statics: the registry is built before the first
+    // ThreadCounters and so outlives every one of them
+    static Registry& registry() noexcept {
+        static Registry reg;
+        return reg;
+    }
+
+    static ThreadCounters& local() noexcept {
+        thread_local ThreadCounters counters;
+        return counters;
+    }
+
+    template<typename Int>
+    static void bump(std::atomic<Int>& counter, long long delta) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + static_cast<Int>(delta),
+                      std::memory_order_relaxed);
+    }
+
+    static void add_in_use(ThreadCounters& c, long long delta) noexcept {
+        bump(c.bytes_in_use, delta);
+        c.pending += delta;
+        if (c.pending >= FLUSH_BYTES || c.pending <= -FLUSH_BYTES) {
+            flush(c);
+        }
+    }
+
+    static void flush(ThreadCounters& c) noexcept {
+        registry().flushed_in_use.fetch_add(c.pending, std::memory_order_relaxed);
+        c.pending = 0;
+    }
+};
+
+} // namespace detail
+
+// ============================================================================
+// tracking_allocator<Alloc, Tag> - counts everything Alloc hands out
+// ============================================================================
+//
+// A thin adaptor: every call forwards to the wrapped allocator (through
+// allocator_traits, so construct/destroy/propagation behave exactly like
+// Alloc's) and records the request in the counters for `Tag`.
+//
+// Tag names the call site. Give each container you want to tell apart its
+// own tag; rebinding keeps the tag, so a node-based container's nodes (or
+// std::vector's debug proxies) land in the same report:
+//
+//   struct OrderBookSite {};
+//   using OrderAlloc = tracking_allocator<allocator<Order>, OrderBookSite>;
+//   std::vector<Order, OrderAlloc> book;
+//   ...
+//   OrderAlloc::report().print("order book");
+//
+// Works anywhere an allocator does: std containers, career's Vector, and
+// career::function's allocator_arg constructor (the heap path rebinds it
+// to its box type).
+
+template<typename Alloc, typename Tag = void>
+class tracking_allocator {
+    using inner_traits = allocator_traits<Alloc>;
+    using stats = detail::tracking_stats<Tag>;
+
+public:
+    using inner_allocator_type = Alloc;
+    using value_type = typename inner_traits::value_type;
+    using size_type = typename inner_traits::size_type;
+    using difference_type = typename inner_traits::difference_type;
+    using pointer = typename inner_traits::pointer;
+    using const_pointer = typename inner_traits::const_pointer;
+    using void_pointer = typename inner_traits::void_pointer;
+    using const_void_pointer = typename inner_traits::const_void_pointer;
+
+    using propagate_on_container_copy_assignment =
+        typename inner_traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment =
+        typename inner_traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename inner_traits::propagate_on_container_swap;
+    using is_always_equal = typename inner_traits::is_always_equal;
+
+    template<typename U>
+    struct rebind {
+        using other = tracking_allocator<typename inner_traits::template rebind_alloc<U>, Tag>;
+    };
+
+    tracking_allocator() = default;
+
+    explicit tracking_allocator(const Alloc& inner) : _inner(inner) {}
+
+    template<typename A>
+    tracking_allocator(const tracking_allocator<A, Tag>& other) : _inner(other.inner()) {}
+
+    [[nodiscard]] pointer allocate(size_type n) {
+        pointer p = inner_traits::allocate(_inner, n);
+        stats::on_allocate(n * sizeof(value_type));
+        return p;
+    }
+
+    void deallocate(pointer p, size_type n) noexcept {
+        stats::on_deallocate(n * sizeof(value_type));
+        inner_traits::deallocate(_inner, p, n);
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        inner_traits::construct(_inner, p, std::forward<Args>(args)...);
+    }
+
+    template<typename U>
+    void destroy(U* p) noexcept {
+        inner_traits::destroy(_inner, p);
+    }
+
+    [[nodiscard]] size_type max_size() const noexcept {
+        return inner_traits::max_size(_inner);
+    }
+
+    tracking_allocator select_on_container_copy_construction() const {
+        return tracking_allocator(inner_traits::select_on_container_copy_construction(_inner));
+    }
+
+    const Alloc& inner() const noexcept {
+        return _inner;
+    }
+
+    // Merged counters of every thread for this Tag
+    static allocation_report report() {
+        return stats::report();
+    }
+
+private:
+    Alloc _inner;
+};
+
+template<typename A, typename B, typename Tag>
+bool operator==(const tracking_allocator<A, Tag>& a, const tracking_allocator<B, Tag>& b) noexcept {
+    return a.inner() == b.inner();
+}
+
+template<typename A, typename B, typename Tag>
+bool operator!=(const tracking_allocator<A, Tag>& a, const tracking_allocator<B, Tag>& b) noexcept {
+    return !(a == b);
+}
+
+} // namespace career
@@ -1,4 +1,7 @@
+#pragma once
+
 #include <cstddef> 
+#include <iterator>
 #include <utility> 
 
 namespace career {
@@ -24,7 +27,7 @@ using false_type = integral_constant<bool, false>;
 
 // ===================================================================
 // PRIMARY TYPE CATEGORIS
-// =================================================================== 
+// ===================================================================
 
 // is_void 
 template<typename T> struct is_void : false_type {}; 
@@ -79,7 +82,7 @@ template<typename T> struct is_rvalue_reference<T&&>: true_type{};
 
 // ===================================================================
 // COMPOSITE TYPE CATEGORIES
-// =================================================================== 
+// ===================================================================
 
 // is_reference 
 template<typename T> 
@@ -96,13 +99,97 @@ struct is_arithmetic : bool_constant<
 // ===================================================================
 
 // is_const 
-template<typename T> struct is_constant: false_type {}; 
-template<typename T> struct is_constant<const T>: true_type{}; 
+template<typename T> struct is_const: false_type {};
+template<typename T> struct is_const<const T>: true_type{};
 
 // is_volatile
 template<typename T> struct is_volatile: false_type {}; 
 template<typename T> struct is_volatile<volatile T>: true_type{}; 
 
+// is_function - functions and references are the only types that stay
+// non-const after adding const
+template<typename T> 
+struct is_function : bool_constant<
+    !is_const<const T>::value && !is_reference<T>::value> {};
+
+// ===================================================================
+// SUPPORTED OPERATIONS
+// ===================================================================
+// 
+// These can't be written in plain C++ (trivial-ness is a property of
+// the special members the compiler generated), so they wrap the same
+// compiler builtins GCC's and Clang's <type_traits> use. They're what
+// the containers ask before taking a memcpy / no-rollback fast path:
+// 
+//   is_trivially_copyable            -> copy / move = memcpy
+//   is_trivially_destructible        -> destroy = nothing
+//   is_nothrow_move_constructible    -> move without a rollback plan
+
+// is_constructible
+template<typename T, typename... Args>
+struct is_constructible : bool_constant<__is_constructible(T, Args...)> {};
+
+// is_nothrow_constructible
+template<typename T, typename... Args>
+struct is_nothrow_constructible : bool_constant<__is_nothrow_constructible(T, Args...)> {};
+
+// is_trivially_constructible
+template<typename T, typename... Args>
+struct is_trivially_constructible : bool_constant<__is_trivially_constructible(T, Args...)> {};
+
+// is_trivially_default_constructible
+template<typename T> 
+struct is_trivially_default_constructible : is_trivially_constructible<T> {};
+
+// is_move_constructible / is_nothrow_move_constructible
+template<typename T> 
+struct is_move_constructible : is_constructible<T, T&&> {};
+
+template<typename T> 
+struct is_nothrow_move_constructible : is_nothrow_constructible<T, T&&> {};
+
+// is_trivially_copyable
+template<typename T> 
+struct is_trivially_copyable : bool_constant<__is_trivially_copyable(T)> {};
+
+// is_trivial
+template<typename T> 
+struct is_trivial : bool_constant<__is_trivial(T)> {};
+
+// is_destructible - a reference is; void, functions and T[] aren't;
+// anything else is if `t.~T()` compiles
+namespace detail {
+    template<typename T, typename = void> 
+    struct is_destructible_impl : false_type {};
+    template<typename T>
+    struct is_destructible_impl<T, decltype(void(std::declval<T&>().~T()))> : true_type {};
+
+    template<typename T> struct strip_extents { using type = T; };
+    template<typename T, size_t N> struct strip_extents<T[N]> : strip_extents<T> {};
+}
+
+template<typename T> 
+struct is_destructible : detail::is_destructible_impl<typename detail::strip_extents<T>::type> {};
+template<typename T> struct is_destructible<T&> : true_type {};
+template<typename T> struct is_destructible<T&&> : true_type {};
+template<typename T> struct is_destructible<T[]> : false_type {};
+
+// is_trivially_destructible - Clang 15+ deprecates __has_trivial_destructor
+// in favour of __is_trivially_destructible; GCC 12 only has the old one
+#if defined(__has_builtin)
+#if __has_builtin(__is_trivially_destructible)
+#define CAREER_IS_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+#endif
+#endif
+#ifndef CAREER_IS_TRIVIALLY_DESTRUCTIBLE
+#define CAREER_IS_TRIVIALLY_DESTRUCTIBLE(T) (is_destructible<T>::value && __has_trivial_destructor(T))
+#endif
+
+template<typename T> 
+struct is_trivially_destructible : bool_constant<CAREER_IS_TRIVIALLY_DESTRUCTIBLE(T)> {};
+
+#undef CAREER_IS_TRIVIALLY_DESTRUCTIBLE
+
 // ===================================================================
 // TYPE RELATIONSHIPS
 // ===================================================================
@@ -111,6 +198,10 @@ template<typename T> struct is_volatile<volatile T>: true_type{};
 template<typename T, typename U> struct is_same: false_type{}; 
 template<typename T> struct is_same<T, T>: true_type{}; 
 
+// is_base_of
+template<typename Base, typename Derived>
+struct is_base_of : bool_constant<__is_base_of(Base, Derived)> {};
+
 // ===================================================================
 // Const-Volatility Specifiers 
 // ===================================================================
@@ -123,7 +214,7 @@ struct remove_const {
 
 template<typename T> 
 struct remove_const<const T> {
-    using type = T; 
+    using type = T;
 }; 
 
 // remove_volatile
@@ -134,7 +225,7 @@ struct remove_volatile {
 
 template<typename T> 
 struct remove_volatile<volatile T> {
-    using type = T; 
+    using type = T;
 }; 
 
 // remove_cv
@@ -147,19 +238,19 @@ struct remove_cv {
 template<typename T> 
 struct add_const {
     using type = const T;
-};
+}; 
 
 // add_volatile
 template<typename T> 
 struct add_volatile {
     using type = volatile T;
-};
+}; 
 
 // add_cv
 template<typename T> 
 struct add_cv {
     using type = const volatile T;
-};
+}; 
 
 // 
 // REFERENCES 
@@ -168,17 +259,17 @@ struct add_cv {
 // remove_reference
 template<typename T> 
 struct remove_reference {
-    using type = T; 
+    using type = T;
 }; 
 
 template<typename T> 
 struct remove_reference<T&> {
-    using type = T; 
+    using type = T;
 }; 
 
 template<typename T> 
 struct remove_reference<T&&> {
-    using type = T; 
+    using type = T;
 }; 
 
 // add_lvalue_reference
@@ -190,7 +281,7 @@ namespace detail {
     template<typename T>
     struct add_lvalue_reference_impl<T, decltype(void(std::declval<T&>()))> {
         using type = T&;
-    };
+    }; 
 }
 
 template<typename T> 
@@ -205,7 +296,7 @@ namespace detail {
     template<typename T>
     struct add_rvalue_reference_impl<T, decltype(void(std::declval<T&&>()))> {
         using type = T&&;
-    };
+    }; 
 }
 
 template<typename T> 
@@ -218,63 +309,76 @@ struct add_rvalue_reference : detail::add_rvalue_reference_impl<T> {};
 // remove_pointer 
 template<typename T> 
 struct remove_pointer {
-    using type = T; 
+    using type = T;
 }; 
 
 template<typename T> 
 struct remove_pointer<T*> {
     using type = T;
-};
+}; 
 
 template<typename T> 
 struct remove_pointer<T* const> {
     using type = T;
-};
+}; 
 
 template<typename T> 
 struct remove_pointer<T* volatile> {
     using type = T;
-};
+}; 
 
 template<typename T> 
 struct remove_pointer<T* const volatile> {
     using type = T;
-};
+}; 
+
+// add_pointer - T* when that's a valid type (not for `void() const`)
+namespace detail {
+    template<typename T, typename = void> 
+    struct add_pointer_impl {
+        using type = T;
+    }; 
+    template<typename T>
+    struct add_pointer_impl<T, decltype(void(std::declval<typename remove_reference<T>::type*>()))> {
+        using type = typename remove_reference<T>::type*;
+    }; 
+}
 
 template<typename T> 
 struct add_pointer: detail::add_pointer_impl<T> {}; 
 
 // 
-// OTHER TRANSFORMATIONS 
+//  Arrays
 // 
 
-// decay 
-namespace detail {
-    template<typename T> 
-    struct decay_impl {
-        using U = typename remove_reference<T>::type; 
-        using type = typename std::conditional<
-            is_array<U>::value, 
-            typename remove_extent<U>::type*, 
-            typename std::conditional<
-                std::is_function<U>::value, 
-                typename add_pointer<U>::type, 
-                typename remove_cv<U>::type
-            >::type
-        >::type
-    };
-}
+// remove_extent
 template<typename T> 
-struct decay : detail::decay_immpl<T> {}; 
+struct remove_extent {
+    using type = T;
+}; 
+
+template<typename T> 
+struct remove_extent<T[]> {
+    using type = T;
+}; 
+
+template<typename T, size_t N>
+struct remove_extent<T[N]> {
+    using type = T;
+}; 
+
+// 
+// OTHER TRANSFORMATIONS 
+// 
 
 // enable_if 
 template<bool B, typename T = void> 
 struct enable_if {}; 
 
-template<typename T>
+template<typename T> 
 struct enable_if<true, T> {
     using type = T;
-};
+}; 
 
 // conditional 
 template<bool B, typename T, typename F> 
@@ -285,7 +389,84 @@ struct conditional {
 template<typename T, typename F>
 struct conditional<false, T, F> {
     using type = F;
-};
+}; 
+
+// ===================================================================
+// LOGICAL OPERATIONS
+// ===================================================================
+// 
+// Short-circuit: conjunction<A, B> never instantiates B::value if A is
+// false, so B may be a trait that doesn't compile for that type.
+
+// conjunction
+template<typename... B> struct conjunction : true_type {};
+template<typename B1> struct conjunction<B1> : B1 {};
+template<typename B1, typename... Bn>
+struct conjunction<B1, Bn...> : conditional<bool(B1::value), conjunction<Bn...>, B1>::type {};
+
+// disjunction
+template<typename... B> struct disjunction : false_type {};
+template<typename B1> struct disjunction<B1> : B1 {};
+template<typename B1, typename... Bn>
+struct disjunction<B1, Bn...> : conditional<bool(B1::value), B1, disjunction<Bn...>>::type {};
+
+// negation
+template<typename B>
+struct negation : bool_constant<!bool(B::value)> {};
+
+// decay 
+namespace detail {
+    template<typename T>
+    struct decay_impl {
+        using U = typename remove_reference<T>::type; 
+        using type = typename conditional<
+            is_array<U>::value, 
+            typename remove_extent<U>::type*, 
+            typename conditional<
+                is_function<U>::value,
+                typename add_pointer<U>::type, 
+                typename remove_cv<U>::type
+            >::type
+        >::type;
+    }; 
+}
+template<typename T> 
+struct decay : detail::decay_impl<T> {};
+
+// void_t - any well-formed types -> void, for detection in partial
+// specializations:
+//   template<typename T, typename = void> struct has_size : false_type {};
+//   template<typename T> struct has_size<T, void_t<decltype(std::declval<T&>().size())>> : true_type {};
+template<typename...>
+using void_t = void;
+
+// is_detected<Op, Args...> - does Op<Args...> name a valid type?
+namespace detail {
+    template<typename AlwaysVoid, template<typename...> class Op, typename... Args>
+    struct is_detected_impl : false_type {};
+    template<template<typename...> class Op, typename... Args>
+    struct is_detected_impl<void_t<Op<Args...>>, Op, Args...> : true_type {};
+}
+
+template<template<typename...> class Op, typename... Args>
+using is_detected = detail::is_detected_impl<void, Op, Args...>;
+
+// ===================================================================
+// ITERATORS
+// ===================================================================
+// 
+// is_contiguous_iterator: *(it + n) is *(std::addressof(*it) + n), so a
+// range of them is one block of memory and can be memcpy'd. True for
+// pointers and for the vector / string / array iterators of libstdc++
+// (a thin wrapper around a pointer); specialize it for your own.
+
+template<typename It> struct is_contiguous_iterator : false_type {};
+template<typename T> struct is_contiguous_iterator<T*> : true_type {};
+
+#if defined(__GLIBCXX__)
+template<typename T, typename Container>
+struct is_contiguous_iterator<__gnu_cxx::__normal_iterator<T*, Container>> : true_type {};
+#endif
 
 // ===========
 // C++14 Alias Template 
@@ -295,42 +476,45 @@ template<typename T>
 using remove_const_t = typename remove_const<T>::type; 
 
 template<typename T> 
-using remove_volatile_t = typename remove_volatile_t<T>::type; 
+using remove_volatile_t = typename remove_volatile<T>::type;
 
-template<typename T>
+template<typename T> 
 using remove_cv_t = typename remove_cv<T>::type;
 
-template<typename T>
+template<typename T> 
 using add_const_t = typename add_const<T>::type;
 
-template<typename T>
+template<typename T> 
 using add_volatile_t = typename add_volatile<T>::type;
 
-template<typename T>
+template<typename T> 
 using add_cv_t = typename add_cv<T>::type;
 
-template<typename T>
+template<typename T> 
 using remove_reference_t = typename remove_reference<T>::type;
 
-template<typename T>
+template<typename T> 
 using add_lvalue_reference_t = typename add_lvalue_reference<T>::type;
 
-template<typename T>
+template<typename T> 
 using add_rvalue_reference_t = typename add_rvalue_reference<T>::type;
 
-template<typename T>
+template<typename T> 
 using remove_pointer_t = typename remove_pointer<T>::type;
 
-template<typename T>
+template<typename T> 
 using add_pointer_t = typename add_pointer<T>::type;
 
-template<typename T>
+template<typename T> 
+using remove_extent_t = typename remove_extent<T>::type;
+
+template<typename T> 
 using decay_t = typename decay<T>::type;
 
-template<bool B, typename T = void>
+template<bool B, typename T = void> 
 using enable_if_t = typename enable_if<B, T>::type;
 
-template<bool B, typename T, typename F>
+template<bool B, typename T, typename F> 
 using conditional_t = typename conditional<B, T, F>::type;
 
 // ==================
@@ -346,32 +530,135 @@ inline constexpr bool is_integral_v = is_integral<T>::value;
 template<typename T> 
 inline constexpr bool is_floating_point_v = is_floating_point<T>::value; 
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_array_v = is_array<T>::value;
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_pointer_v = is_pointer<T>::value;
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_lvalue_reference_v = is_lvalue_reference<T>::value;
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_rvalue_reference_v = is_rvalue_reference<T>::value;
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_reference_v = is_reference<T>::value;
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_arithmetic_v = is_arithmetic<T>::value;
 
-template<typename T>
+template<typename T> 
+inline constexpr bool is_function_v = is_function<T>::value;
+
+template<typename T> 
 inline constexpr bool is_const_v = is_const<T>::value;
 
-template<typename T>
+template<typename T> 
 inline constexpr bool is_volatile_v = is_volatile<T>::value;
 
+template<typename T, typename... Args>
+inline constexpr bool is_constructible_v = is_constructible<T, Args...>::value;
+
+template<typename T, typename... Args>
+inline constexpr bool is_nothrow_constructible_v = is_nothrow_constructible<T, Args...>::value;
+
+template<typename T, typename... Args>
+inline constexpr bool is_trivially_constructible_v = is_trivially_constructible<T, Args...>::value;
+
+template<typename T> 
+inline constexpr bool is_trivially_default_constructible_v = is_trivially_default_constructible<T>::value;
+
+template<typename T> 
+inline constexpr bool is_move_constructible_v = is_move_constructible<T>::value;
+
+template<typename T> 
+inline constexpr bool is_nothrow_move_constructible_v = is_nothrow_move_constructible<T>::value;
+
+template<typename T> 
+inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+
+template<typename T> 
+inline constexpr bool is_trivial_v = is_trivial<T>::value;
+
+template<typename T> 
+inline constexpr bool is_destructible_v = is_destructible<T>::value;
+
+template<typename T> 
+inline constexpr bool is_trivially_destructible_v = is_trivially_destructible<T>::value;
+
 template<typename T, typename U>
 inline constexpr bool is_same_v = is_same<T, U>::value;
 
+template<typename Base, typename Derived>
+inline constexpr bool is_base_of_v = is_base_of<Base, Derived>::value;
+
+template<typename... B>
+inline constexpr bool conjunction_v = conjunction<B...>::value;
+
+template<typename... B>
+inline constexpr bool disjunction_v = disjunction<B...>::value;
+
+template<typename B>
+inline constexpr bool negation_v = negation<B>::value;
+
+template<template<typename...> class Op, typename... Args>
+inline constexpr bool is_detected_v = is_detected<Op, Args...>::value;
+
+template<typename It>
+inline constexpr bool is_contiguous_iterator_v = is_contiguous_iterator<It>::value;
+
+// ==================
+// SELF-CHECKS
+// ==================
+
+namespace detail::type_traits_checks {
+    struct Trivial { int a; double b; };
+    struct NonTrivialCopy { NonTrivialCopy(const NonTrivialCopy&) {} };
+    struct ThrowingMove { ThrowingMove(ThrowingMove&&) noexcept(false) {} };
+    struct NothrowMove { NothrowMove(NothrowMove&&) noexcept {} ~NothrowMove() {} };
+    struct Base {};
+    struct Derived : Base {};
+    struct HasSize { size_t size() const; };
+    template<typename T> using size_of_member = decltype(std::declval<T&>().size());
+
+    static_assert(is_const_v<const int> && !is_const_v<int>);
+    static_assert(is_function_v<void(int)> && !is_function_v<void(*)(int)> && !is_function_v<int&>);
+
+    static_assert(is_trivially_copyable_v<int> && is_trivially_copyable_v<Trivial>);
+    static_assert(!is_trivially_copyable_v<NonTrivialCopy>);
+    static_assert(is_trivial_v<Trivial> && !is_trivial_v<NothrowMove>);
+    static_assert(is_trivially_constructible_v<int, const int&>);
+    static_assert(is_trivially_default_constructible_v<Trivial>);
+
+    static_assert(is_trivially_destructible_v<int> && is_trivially_destructible_v<Trivial[4]>);
+    static_assert(is_trivially_destructible_v<int&>);
+    static_assert(!is_trivially_destructible_v<NothrowMove> && !is_trivially_destructible_v<void>);
+    static_assert(is_destructible_v<NothrowMove> && !is_destructible_v<int[]>);
+
+    static_assert(is_nothrow_move_constructible_v<int> && is_nothrow_move_constructible_v<NothrowMove>);
+    static_assert(is_move_constructible_v<ThrowingMove> && !is_nothrow_move_constructible_v<ThrowingMove>);
+
+    static_assert(is_base_of_v<Base, Derived> && !is_base_of_v<Derived, Base>);
+    static_assert(is_base_of_v<std::forward_iterator_tag, std::random_access_iterator_tag>);
+
+    static_assert(conjunction_v<> && conjunction_v<true_type, true_type> && !conjunction_v<true_type, false_type>);
+    static_assert(!disjunction_v<> && disjunction_v<false_type, true_type>);
+    static_assert(!conjunction_v<false_type, int>);   // short-circuits: int has no ::value
+    static_assert(disjunction_v<true_type, int>);
+    static_assert(negation_v<false_type>);
+
+    static_assert(is_same_v<void_t<int, char>, void>);
+    static_assert(is_same_v<enable_if_t<true, int>, int>);
+    static_assert(is_detected_v<size_of_member, HasSize>);
+    static_assert(!is_detected_v<size_of_member, int>);
+
+    static_assert(is_same_v<decay_t<const int&>, int> && is_same_v<decay_t<int[3]>, int*>);
+    static_assert(is_same_v<decay_t<void(int)>, void(*)(int)>);
+    static_assert(is_same_v<remove_volatile_t<volatile int>, int>);
+
+    static_assert(is_contiguous_iterator_v<int*> && is_contiguous_iterator_v<const int*>);
+    static_assert(!is_contiguous_iterator_v<std::reverse_iterator<int*>>);
+}
 
-}
\ No newline at end of file
+} // namespace career
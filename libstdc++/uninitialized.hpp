@@ -1,61 +1,303 @@
+#pragma once
+
 #include <utility> 
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <new> 
 
+#include "segmented_iterator.hpp"
+#include "simd_fill.hpp"
+#include "type_traits.hpp"
+
 namespace career {
 
 // ==================================================
-// destroy - call desctructors on a range 
+// Fast paths - when placement new IS just a memcpy
+// ==================================================
+//
+// For contiguous iterators (pointers, vector / string iterators - see
+// career::is_contiguous_iterator) over trivially copyable types, copying
+// an object is copying its bytes, and constructing it can't throw. So:
+//
+//   uninitialized_copy / move  -> memmove   (no loop, no try/catch)
+//   uninitialized_fill         -> memset    (1-byte types, or an all-zero value)
+//                              -> SSE2/AVX2 pattern stores otherwise, and
+//                                 non-temporal ones past a few MiB
+//                                 (simd_fill.hpp)
+//   default construct (trivial)-> nothing
+//   destroy (trivially destructible) -> nothing
+//
+// memmove rather than memcpy: Deque shifts elements within one buffer,
+// where source and destination may overlap. Segmented ranges (Deque) are
+// split into one pointer range per buffer first, so they reach the same
+// fast paths (segmented_iterator.hpp). Everything else (list / map
+// iterators, non-trivial types) takes the element-by-element path below.
+
+namespace detail {
+
+// The element type an iterator refers to, cv-qualifiers kept
+template<typename It>
+using iter_element_t = remove_reference_t<decltype(*std::declval<It&>())>;
+
+// Raw pointer to *it; for contiguous iterators, and only on non-empty ranges
+template<typename It>
+auto to_address(It it) noexcept {
+    if constexpr (is_pointer_v<It>) {
+        return it;
+    } else {
+        return std::addressof(*it);
+    }
+}
+
+// Can `Src` -> `Dst` construction with argument `Arg` be done as a byte copy?
+template<typename SrcIt, typename DstIt, typename Arg>
+inline constexpr bool is_bitwise_constructible_v = [] {
+    if constexpr (is_contiguous_iterator_v<SrcIt> && is_contiguous_iterator_v<DstIt>) {
+        using Src = remove_cv_t<iter_element_t<SrcIt>>;
+        using Dst = iter_element_t<DstIt>;
+        return is_same_v<Src, Dst> && !is_const_v<Dst> && !is_volatile_v<Dst> &&
+               is_trivially_copyable_v<Dst> && is_trivially_constructible_v<Dst, Arg>;
+    } else {
+        return false;
+    }
+}();
+
+template<typename T>
+bool is_all_zero_bytes(const T& value) noexcept {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(std::addressof(value));
+    for (size_t i = 0; i < sizeof(T); i++) {
+        if (bytes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fill [first, first + n) of trivially copyable T with value, no throw.
+// memset is already vectorized, so it keeps single-byte patterns until
+// they're big enough to stream; other patterns go to the SIMD kernels.
+template<typename T>
+void fill_trivial(T* first, size_t n, const T& value) noexcept {
+    if (n == 0) {
+        return;
+    }
+    const size_t bytes = n * sizeof(T);
+    const bool byte_pattern = sizeof(T) == 1 || is_all_zero_bytes(value);
+    if (byte_pattern && bytes < STREAM_THRESHOLD) {
+        std::memset(static_cast<void*>(first), *reinterpret_cast<const unsigned char*>(std::addressof(value)), bytes);
+        return;
+    }
+    if (simd_fill(first, bytes, std::addressof(value), sizeof(T))) {
+        return;
+    }
+    if (byte_pattern) {
+        std::memset(static_cast<void*>(first), *reinterpret_cast<const unsigned char*>(std::addressof(value)), bytes);
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        ::new (static_cast<void*>(first + i)) T(value);
+    }
+}
+
+} // namespace detail
+
+// ==================================================
+// destroy - call destructors on a range 
 // ==================================================
 
 template<typename ForwardIt> 
 void destroy(ForwardIt first, ForwardIt last) noexcept {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    for(; first != last; ++first) {
-        std::addressof(*first)->~value_type();
+    if constexpr (is_trivially_destructible_v<value_type>) {
+        return;
+    } else if constexpr (is_segmented_iterator_v<ForwardIt>) {
+        using Traits = segmented_iterator_traits<ForwardIt>;
+        auto seg = Traits::segment(first);
+        const auto seg_last = Traits::segment(last);
+        if (seg == seg_last) {
+            career::destroy(Traits::local(first), Traits::local(last));
+            return;
+        }
+        career::destroy(Traits::local(first), Traits::segment_end(seg));
+        for (++seg; seg != seg_last; ++seg) {
+            career::destroy(Traits::segment_begin(seg), Traits::segment_end(seg));
+        }
+        career::destroy(Traits::segment_begin(seg), Traits::local(last));
+    } else {
+        for(; first != last; ++first) {
+            std::addressof(*first)->~value_type();
+        }
     }
 }
 
 template<typename ForwardIt, typename Size> 
 ForwardIt destroy_n(ForwardIt first, Size n) noexcept {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    for(; n > 0; n--, first++) {
-        std::addressof(*first)->~value_type();
+    if constexpr (is_trivially_destructible_v<value_type>) {
+        return n > 0 ? std::next(first, n) : first;
+    } else {
+        for(; n > 0; n--, first++) {
+            std::addressof(*first)->~value_type();
+        }
+        return first;
     }
-    return first;
 }   
 
 // ===================================================
-// uninitialized_copy - Copy into uninitialized memory 
+// Segmented ranges - one contiguous piece at a time
 // ===================================================
+//
+// piece(src_first, src_last, dst) constructs one contiguous piece and
+// returns the end of what it built (it rolls back its own piece if it
+// throws); these helpers cut the range into pieces and roll back the
+// pieces already built.
+//
+//   segmented source      : one piece per source segment, local iterators
+//   segmented destination : one piece per destination segment, the source
+//                           sliced to match (needs a random access source)
+
+namespace detail {
 
 template<typename InputIt, typename ForwardIt>
-ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
-    using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = d_first; 
+inline constexpr bool use_segmented_v =
+    is_segmented_iterator_v<InputIt> ||
+    (is_segmented_iterator_v<ForwardIt> &&
+     is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>);
+
+template<typename InputIt, typename ForwardIt, typename Piece>
+ForwardIt segmented_construct(InputIt first, InputIt last, ForwardIt d_first, Piece piece) {
+    if constexpr (is_segmented_iterator_v<InputIt>) {
+        using Traits = segmented_iterator_traits<InputIt>;
+        auto seg = Traits::segment(first);
+        const auto seg_last = Traits::segment(last);
+        ForwardIt current = d_first;
+        try {
+            if (seg == seg_last) {
+                return piece(Traits::local(first), Traits::local(last), current);
+            }
+            current = piece(Traits::local(first), Traits::segment_end(seg), current);
+            for (++seg; seg != seg_last; ++seg) {
+                current = piece(Traits::segment_begin(seg), Traits::segment_end(seg), current);
+            }
+            return piece(Traits::segment_begin(seg), Traits::local(last), current);
+        } catch(...) {
+            career::destroy(d_first, current);
+            throw;
+        }
+    } else {
+        using Traits = segmented_iterator_traits<ForwardIt>;
+        using difference_type = typename std::iterator_traits<ForwardIt>::difference_type;
+        auto seg = Traits::segment(d_first);
+        auto local = Traits::local(d_first);
+        difference_type remaining = last - first;
+        difference_type done = 0;
+        try {
+            while (remaining > 0) {
+                const difference_type room = Traits::segment_end(seg) - local;
+                const difference_type count = room < remaining ? room : remaining;
+                piece(first, first + count, local);
+                first += count;
+                done += count;
+                remaining -= count;
+                if (remaining > 0) {
+                    ++seg;
+                    local = Traits::segment_begin(seg);
+                }
+            }
+        } catch(...) {
+            career::destroy_n(d_first, done);
+            throw;
+        }
+        return d_first + done;
+    }
+}
+
+// fill(local_first, local_last) over each segment of [first, last)
+template<typename ForwardIt, typename Fill>
+void segmented_fill(ForwardIt first, ForwardIt last, Fill fill) {
+    using Traits = segmented_iterator_traits<ForwardIt>;
+    using difference_type = typename std::iterator_traits<ForwardIt>::difference_type;
+    auto seg = Traits::segment(first);
+    const auto seg_last = Traits::segment(last);
+    if (seg == seg_last) {
+        fill(Traits::local(first), Traits::local(last));
+        return;
+    }
+    difference_type done = 0;
     try {
-        for (; first != last; ++first, ++current) {
-            ::new(static_cast<void*>(std::addressof(*current))) value_type(*first);
+        fill(Traits::local(first), Traits::segment_end(seg));
+        done += Traits::segment_end(seg) - Traits::local(first);
+        for (++seg; seg != seg_last; ++seg) {
+            fill(Traits::segment_begin(seg), Traits::segment_end(seg));
+            done += Traits::segment_end(seg) - Traits::segment_begin(seg);
         }
-        return current;
+        fill(Traits::segment_begin(seg), Traits::local(last));
     } catch(...) {
-        destroy(d_first, current);
+        career::destroy_n(first, done);
         throw;
     }
 }
 
+} // namespace detail
+
+// ===================================================
+// uninitialized_copy - Copy into uninitialized memory 
+// ===================================================
+
+template<typename InputIt, typename ForwardIt>
+ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
+    if constexpr (detail::use_segmented_v<InputIt, ForwardIt>) {
+        return detail::segmented_construct(first, last, d_first, [](auto f, auto l, auto d) {
+            return career::uninitialized_copy(f, l, d);
+        });
+    } else if constexpr (detail::is_bitwise_constructible_v<InputIt, ForwardIt, decltype(*first)>) {
+        const size_t n = size_t(last - first);
+        if (n) {
+            std::memmove(static_cast<void*>(detail::to_address(d_first)),
+                         static_cast<const void*>(detail::to_address(first)), n * sizeof(value_type));
+        }
+        return d_first + n;
+    } else {
+        ForwardIt current = d_first; 
+        try {
+            for (; first != last; ++first, ++current) {
+                ::new(static_cast<void*>(std::addressof(*current))) value_type(*first);
+            }
+            return current;
+        } catch(...) {
+            career::destroy(d_first, current);
+            throw;
+        }
+    }
+}
+
 template<typename InputIt, typename Size, typename ForwardIt> 
 ForwardIt uninitialized_copy_n(InputIt first, Size n, ForwardIt d_first) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = d_first; 
-    try {
-        for (; n > 0; n--, current++, first++) {
-            ::new(static_cast<void*>(std::addressof(*current))) value_type(*first);
+    if constexpr (detail::use_segmented_v<InputIt, ForwardIt> &&
+                  is_base_of_v<std::random_access_iterator_tag,
+                                    typename std::iterator_traits<InputIt>::iterator_category>) {
+        return n > 0 ? career::uninitialized_copy(first, first + n, d_first) : d_first;
+    } else if constexpr (detail::is_bitwise_constructible_v<InputIt, ForwardIt, decltype(*first)>) {
+        if (n <= 0) {
+            return d_first;
+        }
+        std::memmove(static_cast<void*>(detail::to_address(d_first)),
+                     static_cast<const void*>(detail::to_address(first)), size_t(n) * sizeof(value_type));
+        return d_first + n;
+    } else {
+        ForwardIt current = d_first; 
+        try {
+            for (; n > 0; n--, current++, first++) {
+                ::new(static_cast<void*>(std::addressof(*current))) value_type(*first);
+            }
+            return current;
+        } catch(...) {
+            career::destroy(d_first, current); 
+            throw;
         }
-        return current;
-    } catch(...) {
-        destroy(d_first, current); 
-        throw;
     }
 }
 
@@ -66,14 +308,25 @@ ForwardIt uninitialized_copy_n(InputIt first, Size n, ForwardIt d_first) {
 template<typename ForwardIt, typename T> 
 void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = first; 
-    try {
-        for (; current != last; current++) {
-            ::new (static_cast<void*>(std::addressof(*current))) value_type(value);
+    if constexpr (is_segmented_iterator_v<ForwardIt>) {
+        detail::segmented_fill(first, last, [&value](auto f, auto l) { career::uninitialized_fill(f, l, value); });
+        return;
+    } else if constexpr (detail::is_bitwise_constructible_v<ForwardIt, ForwardIt, const value_type&> &&
+                  is_same_v<T, value_type>) {
+        if (first != last) {
+            detail::fill_trivial(detail::to_address(first), size_t(last - first), value);
+        }
+        return;
+    } else {
+        ForwardIt current = first; 
+        try {
+            for (; current != last; current++) {
+                ::new (static_cast<void*>(std::addressof(*current))) value_type(value);
+            }
+        } catch(...) {
+            career::destroy(first, current); 
+            throw;
         }
-    } catch(...) {
-        destroy(first, current); 
-        throw;
     }
 }
 
@@ -81,15 +334,24 @@ void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) {
 template<typename ForwardIt, typename Size, typename T> 
 ForwardIt uninitialized_fill_n(ForwardIt first, Size n, const T& value) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = first;
-    try {
-        for (; n > 0; n--, current++) {
-            ::new (static_cast<void*>(std::addressof(*current))) value_type(value);
+    if constexpr (detail::is_bitwise_constructible_v<ForwardIt, ForwardIt, const value_type&> &&
+                  is_same_v<T, value_type>) {
+        if (n <= 0) {
+            return first;
+        }
+        detail::fill_trivial(detail::to_address(first), size_t(n), value);
+        return first + n;
+    } else {
+        ForwardIt current = first;
+        try {
+            for (; n > 0; n--, current++) {
+                ::new (static_cast<void*>(std::addressof(*current))) value_type(value);
+            }
+            return current;
+        } catch(...) {
+            career::destroy(first, current);
+            throw;
         }
-        return current;
-    } catch(...) {
-        destroy(first, current);
-        throw;
     }
 }
 
@@ -100,30 +362,153 @@ ForwardIt uninitialized_fill_n(ForwardIt first, Size n, const T& value) {
 template<typename InputIt, typename ForwardIt>
 ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = d_first; 
-    try {
-        for (; first != last; first++, current++) {
-            ::new(static_cast<void*>(std::addressof(*current))) value_type(std::move(*first));
+    if constexpr (detail::use_segmented_v<InputIt, ForwardIt>) {
+        return detail::segmented_construct(first, last, d_first, [](auto f, auto l, auto d) {
+            return career::uninitialized_move(f, l, d);
+        });
+    } else if constexpr (detail::is_bitwise_constructible_v<InputIt, ForwardIt, decltype(std::move(*first))>) {
+        return career::uninitialized_copy(first, last, d_first);
+    } else {
+        ForwardIt current = d_first; 
+        try {
+            for (; first != last; first++, current++) {
+                ::new(static_cast<void*>(std::addressof(*current))) value_type(std::move(*first));
+            }
+            return current;
+        } catch(...) {
+            career::destroy(d_first, current); 
+            throw; 
         }
-        return current;
-    } catch(...) {
-        destroy(d_first, current); 
-        throw; 
     }
 }
 
 template<typename InputIt, typename Size, typename ForwardIt>
 std::pair<InputIt, ForwardIt> uninitialized_move_n(InputIt first, Size n, ForwardIt d_first) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = d_first;
-    try {
-        for (; n > 0; n--, current++, first++) {
-            ::new(static_cast<void*>(std::addressof(*current)))value_type(std::move(*first));
+    if constexpr (detail::is_bitwise_constructible_v<InputIt, ForwardIt, decltype(std::move(*first))>) {
+        const Size count = n > 0 ? n : 0;
+        return {first + count, career::uninitialized_copy_n(first, count, d_first)};
+    } else {
+        ForwardIt current = d_first;
+        try {
+            for (; n > 0; n--, current++, first++) {
+                ::new(static_cast<void*>(std::addressof(*current)))value_type(std::move(*first));
+            }
+            return {first, current};
+        } catch(...) {
+            career::destroy(d_first, current);
+            throw; 
         }
-        return {first, current};
-    } catch(...) {
-        destroy(d_first, current);
-        throw; 
+    }
+}
+
+// ============================================================================
+// Relocation - move + destroy in one step
+// ============================================================================
+//
+// Growing a buffer is "move every element to the new storage, then destroy
+// the old ones" - two passes. For most types the pair is just a byte copy:
+// the moved-to object takes over the source's bits, and destroying the
+// moved-from source does nothing observable. Such a type is TRIVIALLY
+// RELOCATABLE:
+//
+//   unique_ptr<T>  { T* p }        relocate = copy p, forget the source   yes
+//   our String     { char* str }   same                                   yes
+//   std::string    { char* p -> own SSO buffer }  p points INTO the
+//                                  object, so moving its bytes breaks it  NO
+//
+// Trivially copyable types are relocatable automatically; anything else
+// opts in by specializing career::is_trivially_relocatable:
+//
+//   template<> struct career::is_trivially_relocatable<MyType> : true_type {};
+//
+// uninitialized_relocate(first, last, d_first): afterwards [d_first, ...)
+// holds the objects and [first, last) is raw storage. Relocatable types
+// over contiguous iterators take one memmove (overlap allowed, so Deque can
+// shift in place). Otherwise, with a noexcept move constructor, each
+// element is moved and its source destroyed in the same pass. A move that
+// may throw gets two passes instead, uninitialized_move then destroy, so
+// that if a move throws the destination is rolled back and the source is
+// left fully alive. Those two cases need non-overlapping ranges.
+
+template<typename T>
+struct is_trivially_relocatable : is_trivially_copyable<T> {};
+
+template<typename T, typename U>
+struct is_trivially_relocatable<std::unique_ptr<T, std::default_delete<U>>> : true_type {};
+
+template<typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : true_type {};
+
+template<typename T>
+struct is_trivially_relocatable<std::weak_ptr<T>> : true_type {};
+
+template<typename T, typename U>
+struct is_trivially_relocatable<std::pair<T, U>>
+    : bool_constant<is_trivially_relocatable<T>::value && is_trivially_relocatable<U>::value> {};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail {
+
+template<typename SrcIt, typename DstIt>
+inline constexpr bool is_bitwise_relocatable_v = [] {
+    if constexpr (is_contiguous_iterator_v<SrcIt> && is_contiguous_iterator_v<DstIt>) {
+        using Src = iter_element_t<SrcIt>;
+        using Dst = iter_element_t<DstIt>;
+        return is_same_v<Src, Dst> && !is_const_v<Dst> && !is_volatile_v<Dst> &&
+               is_trivially_relocatable_v<Dst>;
+    } else {
+        return false;
+    }
+}();
+
+} // namespace detail
+
+template<typename InputIt, typename ForwardIt>
+ForwardIt uninitialized_relocate(InputIt first, InputIt last, ForwardIt d_first) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
+    if constexpr (detail::is_bitwise_relocatable_v<InputIt, ForwardIt>) {
+        const size_t n = size_t(last - first);
+        if (n) {
+            std::memmove(static_cast<void*>(detail::to_address(d_first)),
+                         static_cast<const void*>(detail::to_address(first)), n * sizeof(value_type));
+        }
+        return d_first + n;
+    } else if constexpr (is_nothrow_move_constructible_v<value_type>) {
+        for (; first != last; ++first, ++d_first) {
+            ::new(static_cast<void*>(std::addressof(*d_first))) value_type(std::move(*first));
+            std::addressof(*first)->~value_type();
+        }
+        return d_first;
+    } else {
+        ForwardIt d_last = career::uninitialized_move(first, last, d_first);
+        career::destroy(first, last);
+        return d_last;
+    }
+}
+
+template<typename InputIt, typename Size, typename ForwardIt>
+std::pair<InputIt, ForwardIt> uninitialized_relocate_n(InputIt first, Size n, ForwardIt d_first) {
+    using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
+    if constexpr (detail::is_bitwise_relocatable_v<InputIt, ForwardIt>) {
+        if (n <= 0) {
+            return {first, d_first};
+        }
+        std::memmove(static_cast<void*>(detail::to_address(d_first)),
+                     static_cast<const void*>(detail::to_address(first)), size_t(n) * sizeof(value_type));
+        return {first + n, d_first + n};
+    } else if constexpr (is_nothrow_move_constructible_v<value_type>) {
+        for (; n > 0; n--, ++first, ++d_first) {
+            ::new(static_cast<void*>(std::addressof(*d_first))) value_type(std::move(*first));
+            std::addressof(*first)->~value_type();
+        }
+        return {first, d_first};
+    } else {
+        auto moved = career::uninitialized_move_n(first, n, d_first);
+        career::destroy(first, moved.first);
+        return moved;
     }
 }
 
@@ -134,28 +519,36 @@ std::pair<InputIt, ForwardIt> uninitialized_move_n(InputIt first, Size n, Forwar
 template<typename ForwardIt> 
 void uninitialized_default_construct(ForwardIt first, ForwardIt last) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = first; 
-    try {
-        for (; current != last ;current++) {
-            ::new(static_cast<void*>(std::addressof(*current)))value_type;
+    if constexpr (is_trivially_default_constructible_v<value_type>) {
+        return;   // `new (p) T` does nothing for trivial T
+    } else {
+        ForwardIt current = first; 
+        try {
+            for (; current != last ;current++) {
+                ::new(static_cast<void*>(std::addressof(*current)))value_type;
+            }
+        } catch(...) {
+            career::destroy(first, current);
+            throw; 
         }
-    } catch(...) {
-        destroy(first, current);
-        throw; 
     }
 }
 
 template<typename ForwardIt, typename Size> 
 void uninitialized_default_construct_n(ForwardIt first, Size n) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = first; 
-    try {
-        for (; n > 0; n--, current++) {
-            ::new(static_cast<void*>(std::addressof(*current)))value_type;
+    if constexpr (is_trivially_default_constructible_v<value_type>) {
+        return;
+    } else {
+        ForwardIt current = first; 
+        try {
+            for (; n > 0; n--, current++) {
+                ::new(static_cast<void*>(std::addressof(*current)))value_type;
+            }
+        } catch(...) {
+            career::destroy(first, current); 
+            throw;
         }
-    } catch(...) {
-        destroy(first, current); 
-        throw;
     }
 }
 
@@ -166,28 +559,44 @@ void uninitialized_default_construct_n(ForwardIt first, Size n) {
 template<typename ForwardIt> 
 void uninitialized_value_construct(ForwardIt first, ForwardIt last) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = first; 
-    try {
-        for (; current != last ;current++) {
-            ::new(static_cast<void*>(std::addressof(*current)))value_type();
+    if constexpr (is_trivial_v<value_type> &&
+                  detail::is_bitwise_constructible_v<ForwardIt, ForwardIt, const value_type&>) {
+        if (first != last) {
+            detail::fill_trivial(detail::to_address(first), size_t(last - first), value_type());   // usually a memset
+        }
+        return;
+    } else {
+        ForwardIt current = first; 
+        try {
+            for (; current != last ;current++) {
+                ::new(static_cast<void*>(std::addressof(*current)))value_type();
+            }
+        } catch(...) {
+            career::destroy(first, current);
+            throw; 
         }
-    } catch(...) {
-        destroy(first, current);
-        throw; 
     }
 }
 
 template<typename ForwardIt, typename Size> 
 void uninitialized_value_construct_n(ForwardIt first, Size n) {
     using value_type = typename std::iterator_traits<ForwardIt>::value_type; 
-    ForwardIt current = first; 
-    try {
-        for (; n > 0; n--, current++) {
-            ::new(static_cast<void*>(std::addressof(*current)))value_type();
+    if constexpr (is_trivial_v<value_type> &&
+                  detail::is_bitwise_constructible_v<ForwardIt, ForwardIt, const value_type&>) {
+        if (n > 0) {
+            detail::fill_trivial(detail::to_address(first), size_t(n), value_type());
+        }
+        return;
+    } else {
+        ForwardIt current = first; 
+        try {
+            for (; n > 0; n--, current++) {
+                ::new(static_cast<void*>(std::addressof(*current)))value_type();
+            }
+        } catch(...) {
+            career::destroy(first, current); 
+            throw;
         }
-    } catch(...) {
-        destroy(first, current); 
-        throw;
     }
 }
 
@@ -1,6 +1,6 @@
 // simple-vector.cpp
 // NOTE: SimpleVector1 and SimpleVector2 don't handle all the edge cases,
-// so use SimpleVector for reference.
+// and reallocate on every push_back, so use SimpleVector for reference.
 
 #include <cassert>
 #include <cstddef>
@@ -273,17 +273,35 @@ struct SimpleVector {
 private:
   ElemTy* m_buffer;
   size_t m_size;
+  size_t m_capacity; // slots in m_buffer, [m_size, m_capacity) are spare
+
+  // copy the elements into a fresh buffer of new_capacity slots
+  void reallocate(size_t new_capacity) {
+    ElemTy* new_buffer = new_capacity ? new ElemTy[new_capacity] : nullptr;
+    try {
+      for (size_t i = 0; i < m_size; i++) {
+        new_buffer[i] = std::move(m_buffer[i]);
+      }
+    } catch (...) {
+      delete[] new_buffer;
+      throw;
+    }
+    delete[] m_buffer;
+    m_buffer = new_buffer;
+    m_capacity = new_capacity;
+  }
 
 public:
-  SimpleVector() : m_buffer(nullptr), m_size(0) {}
-  SimpleVector(const SimpleVector& other) : m_size(other.m_size) {
-    m_buffer = new ElemTy[m_size];
+  SimpleVector() : m_buffer(nullptr), m_size(0), m_capacity(0) {}
+  SimpleVector(const SimpleVector& other)
+      : m_size(other.m_size), m_capacity(other.m_size) {
+    m_buffer = m_size ? new ElemTy[m_size] : nullptr;
     for (size_t i = 0; i < m_size; i++) {
       m_buffer[i] = other.m_buffer[i];
     }
   }
   SimpleVector(std::initializer_list<ElemTy> init_list)
-      : m_size(init_list.size()) {
+      : m_size(init_list.size()), m_capacity(init_list.size()) {
     m_buffer = new ElemTy[m_size];
     for (size_t i = 0; i < init_list.size(); i++) {
       m_buffer[i] = std::data(init_list)[i];
@@ -308,35 +326,41 @@ public:
   }
 #endif
 
+  // SimpleVector1/2 copy the whole buffer on every push: n pushes cost
+  // 1 + 2 + ... + n = O(n^2) copies. Doubling the capacity instead means
+  // each element is copied O(1) times on average (n + n/2 + n/4 ... < 2n).
   void push_back(const ElemTy& element) {
-    ElemTy* new_buffer = new ElemTy[m_size + 1];
-    for (size_t i = 0; i < m_size; i++) {
-      new_buffer[i] = m_buffer[i];
+    if (m_size == m_capacity) {
+      ElemTy copy = element; // element may live in m_buffer
+      reallocate(m_capacity ? 2 * m_capacity : 1);
+      m_buffer[m_size] = std::move(copy);
+    } else {
+      m_buffer[m_size] = element;
     }
-    new_buffer[m_size] = element;
     m_size += 1;
-
-    delete[] m_buffer;
-    m_buffer = new_buffer;
   }
   ElemTy pop_back() {
     assert(m_size > 0);
-    ElemTy* new_buffer = new ElemTy[m_size - 1];
-    for (size_t i = 0; i < m_size - 1; i++) {
-      new_buffer[i] = m_buffer[i];
-    }
-
-    ElemTy last_elem = m_buffer[m_size - 1];
     m_size -= 1;
-
-    delete[] m_buffer;
-    m_buffer = new_buffer;
-
-    return last_elem;
+    return std::move(m_buffer[m_size]);
+  }
+  // exactly new_capacity slots, if that's more than we have
+  void reserve(size_t new_capacity) {
+    if (new_capacity > m_capacity) {
+      reallocate(new_capacity);
+    }
+  }
+  void shrink_to_fit() {
+    if (m_capacity > m_size) {
+      reallocate(m_size);
+    }
   }
   size_t size() const {
     return m_size;
   }
+  size_t capacity() const {
+    return m_capacity;
+  }
   ElemTy& operator[](size_t idx) {
     return m_buffer[idx];
   }
@@ -346,6 +370,7 @@ public:
   void swap(SimpleVector& other) {
     std::swap(m_buffer, other.m_buffer);
     std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
   }
   friend void swap(SimpleVector& a, SimpleVector& b) {
     a.swap(b);
@@ -388,6 +413,7 @@ public:
   }
 };
 // wsl is 
+#ifndef SIMPLE_VECTOR_NO_MAIN
 int main() {
   SimpleVector1<int> sv1{1, 2, 3, 4};
   sv1 = sv1;
@@ -407,4 +433,5 @@ int main() {
   // Nest nested{{Nest{{Nest{}, Nest{}}}}};
 
   // nested = nested.nests[0];
-}
\ No newline at end of file
+}
+#endif